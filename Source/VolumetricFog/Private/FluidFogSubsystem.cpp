@@ -0,0 +1,348 @@
+#include "FluidFogSubsystem.h"
+
+#include "FogSceneViewExtension.h"
+#include "FluidSimulationComponent.h"
+#include "SceneViewExtension.h"
+#include "RenderingThread.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Fluid Fog Schedule"), STAT_VFF_FluidFogSchedule, STATGROUP_VolumetricFog);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Simulation Steps"), STAT_VFF_SimulationSteps, STATGROUP_VolumetricFog);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Deferred Simulation Steps"), STAT_VFF_DeferredSimulationSteps, STATGROUP_VolumetricFog);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Simulation GPU Estimate (ms)"), STAT_VFF_SimulationGPUEstimate, STATGROUP_VolumetricFog);
+
+static TAutoConsoleVariable<float> CVarFluidFogSimulationBudgetMs(
+	TEXT("r.VolumetricFluidFog.SimulationBudgetMs"),
+	4.0f,
+	TEXT("프레임당 전체 Fog Simulation GPU 시간 예산 (ms, 0 = 제한 없음)\n")
+	TEXT("넘는 Volume은 다음 프레임으로 미룸 (MaxDeferredTime 이상 밀리면 예산과 관계없이 step)"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarFluidFogSimulationLOD(
+	TEXT("r.VolumetricFluidFog.SimulationLOD"),
+	1,
+	TEXT("0 = 모든 Volume을 SimResolution으로 매 프레임, 1 = 화면 점유율 / 거리로 해상도와 tick 빈도 조절"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarFluidFogInvisibleTickRate(
+	TEXT("r.VolumetricFluidFog.InvisibleTickRate"),
+	2.0f,
+	TEXT("화면 밖 Volume의 Simulation step 빈도 (Hz, 0 = 화면에 들어올 때까지 정지)"),
+	ECVF_Default);
+
+namespace FluidFogSubsystem
+{
+	/** 이 화면 점유율 이상이면 LOD 0, 1 (나머지는 LOD 2) */
+	constexpr float LODCoverageThresholds[] = { 0.1f, 0.02f };
+	constexpr int32 MaxLODLevel = UE_ARRAY_COUNT(LODCoverageThresholds);
+	
+	/** 현재 LOD를 유지할 때는 threshold를 낮춰 경계에서 LOD가 오가지 않도록 */
+	constexpr float LODCoverageHysteresis = 0.75f;
+	
+	/** LOD별 tick 간격 (초, 0 = 매 프레임) */
+	constexpr float LODTickIntervals[] = { 0.0f, 1.0f / 30.0f, 1.0f / 15.0f };
+	
+	/** 해상도를 낮추는 재샘플 사이 최소 간격 (높이는 것은 즉시) */
+	constexpr float ResolutionDowngradeCooldown = 1.0f;
+	
+	/** 한 step에 적용할 최대 시간 (넘는 시간은 버림, 낮은 tick 빈도에서의 안정성) */
+	constexpr float MaxStepDeltaTime = 0.1f;
+	
+	/** 예산 때문에 이 시간 이상 밀린 Volume은 예산과 관계없이 step */
+	constexpr float MaxDeferredTime = 0.25f;
+	
+	/**
+	 * Bounding sphere를 화면에 투영한 원의 면적 비율 (0 = 시야 밖 또는 MaxDistance 너머)
+	 * 카메라가 Box 안에 있으면 1
+	 */
+	float ComputeScreenCoverage(const FMinimalViewInfo& View, const FBox& Bounds, float MaxDistance)
+	{
+		if (Bounds.IsInsideOrOn(View.Location))
+		{
+			return 1.0f;
+		}
+		
+		// Fog Ray March는 MaxRayDistance까지만 진행
+		if (Bounds.ComputeSquaredDistanceToPoint(View.Location) > FMath::Square(static_cast<double>(MaxDistance)))
+		{
+			return 0.0f;
+		}
+		
+		const FVector ToCenter = Bounds.GetCenter() - View.Location;
+		const double Distance = ToCenter.Size();
+		const double Radius = Bounds.GetExtent().Size();
+		if (Distance <= Radius)
+		{
+			return 1.0f;
+		}
+		
+		const double AspectRatio = View.AspectRatio > 0.0f ? View.AspectRatio : 16.0 / 9.0;
+		const double TanHalfFOV = FMath::Tan(FMath::DegreesToRadians(FMath::Clamp(static_cast<double>(View.FOV), 1.0, 170.0) * 0.5));
+		
+		// 화면 대각선 시야 원뿔 밖
+		const double HalfDiagonalAngle = FMath::Atan(TanHalfFOV * FMath::Sqrt(1.0 + 1.0 / FMath::Square(AspectRatio)));
+		const double AngleToCenter = FMath::Acos(FMath::Clamp(FVector::DotProduct(View.Rotation.Vector(), ToCenter / Distance), -1.0, 1.0));
+		if (AngleToCenter - FMath::Asin(Radius / Distance) > HalfDiagonalAngle)
+		{
+			return 0.0f;
+		}
+		
+		// NDC 기준: 화면 폭 2, 높이 2 / AspectRatio
+		const double ProjectedRadius = Radius / (Distance * TanHalfFOV);
+		const double Coverage = UE_DOUBLE_PI * FMath::Square(ProjectedRadius) * AspectRatio / 4.0;
+		return static_cast<float>(FMath::Clamp(Coverage, UE_DOUBLE_SMALL_NUMBER, 1.0));
+	}
+	
+	int32 SelectLODLevel(float Coverage, int32 CurrentLODLevel)
+	{
+		if (Coverage <= 0.0f)
+		{
+			return INDEX_NONE;
+		}
+		
+		for (int32 Level = 0; Level < MaxLODLevel; ++Level)
+		{
+			const bool bKeepOrCoarser = CurrentLODLevel != INDEX_NONE && Level >= CurrentLODLevel;
+			const float Threshold = LODCoverageThresholds[Level] * (bKeepOrCoarser ? LODCoverageHysteresis : 1.0f);
+			if (Coverage >= Threshold)
+			{
+				return Level;
+			}
+		}
+		return MaxLODLevel;
+	}
+	
+	/** 음수면 step 안 함 (화면 밖 + InvisibleTickRate 0) */
+	float GetTickInterval(int32 LODLevel)
+	{
+		if (LODLevel == INDEX_NONE)
+		{
+			const float InvisibleTickRate = CVarFluidFogInvisibleTickRate.GetValueOnGameThread();
+			return InvisibleTickRate > 0.0f ? 1.0f / InvisibleTickRate : -1.0f;
+		}
+		return LODTickIntervals[FMath::Clamp(LODLevel, 0, MaxLODLevel)];
+	}
+}
+
+bool UFluidFogSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Simulation은 BeginPlay부터 동작
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFluidFogSubsystem::Deinitialize()
+{
+	FogVolumes.Empty();
+	
+	if (FogExtension.IsValid())
+	{
+		// PostOpaque 델리게이트 해제를 진행 중인 렌더 이후로
+		ENQUEUE_RENDER_COMMAND(FReleaseFogExtension)(
+			[LocalFogExtension = MoveTemp(FogExtension)](FRHICommandListImmediate& RHICmdList) mutable
+			{
+				LocalFogExtension.Reset();
+			});
+	}
+	
+	Super::Deinitialize();
+}
+
+TStatId UFluidFogSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFluidFogSubsystem, STATGROUP_Tickables);
+}
+
+void UFluidFogSubsystem::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VFF_FluidFogSchedule);
+	
+	FogVolumes.RemoveAll([](const FFluidFogVolumeSchedule& Schedule)
+	{
+		return !Schedule.Component.IsValid();
+	});
+	
+	UpdateVolumeLODs(DeltaTime);
+	StepSimulations();
+}
+
+void UFluidFogSubsystem::UpdateVolumeLODs(float DeltaTime)
+{
+	TArray<FMinimalViewInfo, TInlineAllocator<4>> Views;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (PlayerController && PlayerController->IsLocalController() && PlayerController->PlayerCameraManager)
+		{
+			Views.Add(PlayerController->PlayerCameraManager->GetCameraCacheView());
+		}
+	}
+	
+	const bool bLODEnabled = CVarFluidFogSimulationLOD.GetValueOnGameThread() != 0 && !Views.IsEmpty();
+	
+	for (FFluidFogVolumeSchedule& Schedule : FogVolumes)
+	{
+		UFluidSimulationComponent* Component = Schedule.Component.Get();
+		Schedule.TimeSinceResolutionChange += DeltaTime;
+		
+		// CPU Simulation(Server)은 Gameplay query용이라 화면과 관계없이 매 프레임
+		FVector BoundsOrigin;
+		FVector BoundsExtent;
+		if (!bLODEnabled || !Component->bEnableSimulationLOD || Component->IsUsingCPUSimulation()
+			|| !Component->ResolveSimulationBounds(BoundsOrigin, BoundsExtent))
+		{
+			Schedule.ScreenCoverage = 1.0f;
+			Schedule.LODLevel = 0;
+		}
+		else
+		{
+			const FBox Bounds = FBox::BuildAABB(BoundsOrigin, BoundsExtent);
+			
+			Schedule.ScreenCoverage = 0.0f;
+			for (const FMinimalViewInfo& View : Views)
+			{
+				Schedule.ScreenCoverage = FMath::Max(Schedule.ScreenCoverage,
+					FluidFogSubsystem::ComputeScreenCoverage(View, Bounds, Component->MaxRayDistance));
+			}
+			Schedule.LODLevel = FluidFogSubsystem::SelectLODLevel(Schedule.ScreenCoverage, Schedule.LODLevel);
+		}
+		
+		// 화면 밖 + InvisibleTickRate 0이면 시간을 쌓지 않고 정지
+		Schedule.PendingDeltaTime = FluidFogSubsystem::GetTickInterval(Schedule.LODLevel) < 0.0f
+			? 0.0f
+			: Schedule.PendingDeltaTime + DeltaTime;
+		
+		// 화면 밖은 가장 낮은 해상도로 유지
+		const int32 ResolutionLOD = Schedule.LODLevel == INDEX_NONE ? FluidFogSubsystem::MaxLODLevel : Schedule.LODLevel;
+		const int32 MinResolution = FMath::Min(Component->MinLODSimResolution, Component->SimResolution);
+		const int32 TargetResolution = FMath::Max(Component->SimResolution >> ResolutionLOD, MinResolution);
+		const int32 CurrentResolution = Component->GetSimulationResolution();
+		
+		if (!Component->IsUsingCPUSimulation() && TargetResolution != CurrentResolution
+			&& (TargetResolution > CurrentResolution || Schedule.TimeSinceResolutionChange >= FluidFogSubsystem::ResolutionDowngradeCooldown))
+		{
+			Component->SetSimulationLODResolution(TargetResolution);
+			Schedule.TimeSinceResolutionChange = 0.0f;
+		}
+	}
+}
+
+void UFluidFogSubsystem::StepSimulations()
+{
+	struct FStepCandidate
+	{
+		int32 Index;
+		float Priority;
+		float EstimatedMilliseconds;
+	};
+	TArray<FStepCandidate, TInlineAllocator<16>> Candidates;
+	
+	for (int32 Index = 0; Index < FogVolumes.Num(); ++Index)
+	{
+		const FFluidFogVolumeSchedule& Schedule = FogVolumes[Index];
+		const UFluidSimulationComponent* Component = Schedule.Component.Get();
+		
+		const float TickInterval = FluidFogSubsystem::GetTickInterval(Schedule.LODLevel);
+		if (TickInterval < 0.0f || Schedule.PendingDeltaTime <= 0.0f || Schedule.PendingDeltaTime < TickInterval)
+		{
+			continue;
+		}
+		
+		// 화면 점유율 우선, 오래 밀린 Volume일수록 앞으로 (Fixed timestep은 이번에 실행될 substep 수만큼)
+		const float StepDeltaTime = FMath::Min(Schedule.PendingDeltaTime, FluidFogSubsystem::MaxStepDeltaTime);
+		const float EstimatedMilliseconds = Component->IsUsingCPUSimulation()
+			? 0.0f
+			: Component->EstimateSimulationGPUMilliseconds(Component->GetSimulationResolution())
+				* static_cast<float>(Component->PredictSimulationSubsteps(StepDeltaTime, FMath::Min(TickInterval, FluidFogSubsystem::MaxStepDeltaTime)));
+		Candidates.Add({ Index, Schedule.ScreenCoverage + Schedule.PendingDeltaTime, EstimatedMilliseconds });
+	}
+	
+	Candidates.Sort([](const FStepCandidate& A, const FStepCandidate& B)
+	{
+		return A.Priority > B.Priority;
+	});
+	
+	const float BudgetMilliseconds = CVarFluidFogSimulationBudgetMs.GetValueOnGameThread();
+	float UsedMilliseconds = 0.0f;
+	int32 NumSteps = 0;
+	int32 NumDeferred = 0;
+	
+	for (const FStepCandidate& Candidate : Candidates)
+	{
+		FFluidFogVolumeSchedule& Schedule = FogVolumes[Candidate.Index];
+		
+		// 첫 Volume은 항상 step (예산보다 큰 Volume 하나가 영원히 멈추지 않도록)
+		const bool bOverBudget = BudgetMilliseconds > 0.0f && UsedMilliseconds > 0.0f
+			&& UsedMilliseconds + Candidate.EstimatedMilliseconds > BudgetMilliseconds;
+		if (bOverBudget && Schedule.PendingDeltaTime < FluidFogSubsystem::MaxDeferredTime)
+		{
+			++NumDeferred;
+			continue;
+		}
+		
+		const float StepDeltaTime = FMath::Min(Schedule.PendingDeltaTime, FluidFogSubsystem::MaxStepDeltaTime);
+		Schedule.PendingDeltaTime = 0.0f;
+		UsedMilliseconds += Candidate.EstimatedMilliseconds;
+		++NumSteps;
+		
+		// LOD tick 간격보다 짧은 고정 step은 쓰지 않음 (LOD로 줄인 tick이 substep 수로 되돌아오지 않도록)
+		const float MinStepInterval = FMath::Min(FluidFogSubsystem::GetTickInterval(Schedule.LODLevel), FluidFogSubsystem::MaxStepDeltaTime);
+		Schedule.Component->StepSimulation(StepDeltaTime, MinStepInterval);
+	}
+	
+	SET_DWORD_STAT(STAT_VFF_SimulationSteps, NumSteps);
+	SET_DWORD_STAT(STAT_VFF_DeferredSimulationSteps, NumDeferred);
+	SET_FLOAT_STAT(STAT_VFF_SimulationGPUEstimate, UsedMilliseconds);
+}
+
+void UFluidFogSubsystem::RegisterFogVolume(UFluidSimulationComponent* Component,
+	const TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>& Volume)
+{
+	check(IsInGameThread());
+	
+	if (!Component || !Volume.IsValid())
+	{
+		return;
+	}
+	
+	if (!FogExtension.IsValid())
+	{
+		FogExtension = FSceneViewExtensions::NewExtension<FFogSceneViewExtension>(GetWorld()->Scene);
+	}
+	
+	if (!FogVolumes.ContainsByPredicate([Component](const FFluidFogVolumeSchedule& Schedule) { return Schedule.Component == Component; }))
+	{
+		FFluidFogVolumeSchedule& Schedule = FogVolumes.AddDefaulted_GetRef();
+		Schedule.Component = Component;
+	}
+	
+	ENQUEUE_RENDER_COMMAND(FRegisterFogVolume)(
+		[LocalFogExtension = FogExtension, Volume](FRHICommandListImmediate& RHICmdList)
+		{
+			LocalFogExtension->AddVolume_RenderThread(Volume);
+		});
+}
+
+void UFluidFogSubsystem::UnregisterFogVolume(UFluidSimulationComponent* Component,
+	const TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>& Volume)
+{
+	check(IsInGameThread());
+	
+	FogVolumes.RemoveAll([Component](const FFluidFogVolumeSchedule& Schedule)
+	{
+		return Schedule.Component == Component;
+	});
+	
+	if (!FogExtension.IsValid() || !Volume.IsValid())
+	{
+		return;
+	}
+	
+	ENQUEUE_RENDER_COMMAND(FUnregisterFogVolume)(
+		[LocalFogExtension = FogExtension, Volume](FRHICommandListImmediate& RHICmdList)
+		{
+			LocalFogExtension->RemoveVolume_RenderThread(Volume);
+		});
+}
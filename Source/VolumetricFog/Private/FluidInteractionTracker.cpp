@@ -0,0 +1,217 @@
+#include "FluidInteractionTracker.h"
+
+#include "Components/PrimitiveComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("VFF Interaction Gather"), STAT_VFF_InteractionGather, STATGROUP_VolumetricFog);
+DECLARE_CYCLE_STAT(TEXT("VFF Interaction Build Sources"), STAT_VFF_InteractionBuildSources, STATGROUP_VolumetricFog);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interaction Actors"), STAT_VFF_InteractionActors, STATGROUP_VolumetricFog);
+
+void FFluidInteractionSourceSlot::TakeSources(TArray<FFluidInteractionForceSource>& OutSources)
+{
+	if (BuildTask.IsValid())
+	{
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(BuildTask);
+		BuildTask.SafeRelease();
+	}
+	OutSources = MoveTemp(Sources);
+}
+
+void FFluidInteractionSourceSlot::ReturnSources(TArray<FFluidInteractionForceSource>&& InSources)
+{
+	Sources = MoveTemp(InSources);
+}
+
+FFluidInteractionTracker::FFluidInteractionTracker()
+{
+	for (TSharedPtr<FFluidInteractionSourceSlot, ESPMode::ThreadSafe>& Slot : Slots)
+	{
+		Slot = MakeShared<FFluidInteractionSourceSlot, ESPMode::ThreadSafe>();
+	}
+}
+
+void FFluidInteractionTracker::Add(UPrimitiveComponent* Comp)
+{
+	const FObjectKey Key(Comp);
+	if (!IsValid(Comp) || IndexByComponent.Contains(Key))
+	{
+		return;
+	}
+
+	IndexByComponent.Add(Key, Components.Num());
+	Components.Add(Comp);
+	ComponentKeys.Add(Key);
+	LastLocations.Add(Comp->Bounds.Origin);
+}
+
+void FFluidInteractionTracker::Remove(UPrimitiveComponent* Comp)
+{
+	if (const int32* Index = IndexByComponent.Find(FObjectKey(Comp)))
+	{
+		RemoveAtSwap(*Index);
+	}
+}
+
+void FFluidInteractionTracker::Reset()
+{
+	Components.Reset();
+	ComponentKeys.Reset();
+	LastLocations.Reset();
+	IndexByComponent.Reset();
+}
+
+void FFluidInteractionTracker::RemoveAtSwap(int32 Index)
+{
+	IndexByComponent.Remove(ComponentKeys[Index]);
+
+	const int32 LastIndex = Components.Num() - 1;
+	if (Index != LastIndex)
+	{
+		IndexByComponent[ComponentKeys[LastIndex]] = Index;
+	}
+
+	Components.RemoveAtSwap(Index);
+	ComponentKeys.RemoveAtSwap(Index);
+	LastLocations.RemoveAtSwap(Index);
+}
+
+TSharedPtr<FFluidInteractionSourceSlot, ESPMode::ThreadSafe> FFluidInteractionTracker::KickBuild(const FFluidInteractionBuildParams& Params)
+{
+	check(IsInGameThread());
+	SCOPE_CYCLE_COUNTER(STAT_VFF_InteractionGather);
+
+	if (Components.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	// Render thread / worker가 아직 잡고 있는 slot은 덮어쓰지 않고 교체
+	TSharedPtr<FFluidInteractionSourceSlot, ESPMode::ThreadSafe>& Slot = Slots[NextSlot];
+	NextSlot = (NextSlot + 1) % NumSlots;
+	if (!Slot.IsUnique())
+	{
+		Slot = MakeShared<FFluidInteractionSourceSlot, ESPMode::ThreadSafe>();
+	}
+
+	const int32 NumActors = Components.Num();
+	Slot->Params = Params;
+	Slot->PrevLocations.Reset(NumActors);
+	Slot->Locations.Reset(NumActors);
+	Slot->Extents.Reset(NumActors);
+
+	// Game thread에서는 캐시된 Bounds만 복사 (계산은 BuildTask)
+	bool bHasStaleComponents = false;
+	for (int32 Index = 0; Index < NumActors; ++Index)
+	{
+		const UPrimitiveComponent* Comp = Components[Index].Get();
+		if (!Comp)
+		{
+			bHasStaleComponents = true;
+			continue;
+		}
+
+		const FBoxSphereBounds& Bounds = Comp->Bounds;
+		Slot->PrevLocations.Add(LastLocations[Index]);
+		Slot->Locations.Add(Bounds.Origin);
+		Slot->Extents.Add(FVector2f(static_cast<float>(Bounds.BoxExtent.X), static_cast<float>(Bounds.BoxExtent.Y)));
+		LastLocations[Index] = Bounds.Origin;
+	}
+
+	// Overlap 종료 이벤트 없이 사라진 Component 정리
+	if (bHasStaleComponents)
+	{
+		for (int32 Index = Components.Num() - 1; Index >= 0; --Index)
+		{
+			if (!Components[Index].IsValid())
+			{
+				RemoveAtSwap(Index);
+			}
+		}
+	}
+
+	INC_DWORD_STAT_BY(STAT_VFF_InteractionActors, Components.Num());
+
+	Slot->BuildTask = FFunctionGraphTask::CreateAndDispatchWhenReady(
+		[SlotRef = Slot.ToSharedRef()]()
+		{
+			SCOPE_CYCLE_COUNTER(STAT_VFF_InteractionBuildSources);
+			BuildSources(SlotRef->Params, SlotRef->PrevLocations, SlotRef->Locations, SlotRef->Extents, SlotRef->Sources);
+		},
+		TStatId(),
+		nullptr,
+		ENamedThreads::AnyBackgroundThreadNormalTask);
+
+	return Slot;
+}
+
+void FFluidInteractionTracker::BuildSources(const FFluidInteractionBuildParams& Params, TConstArrayView<FVector> PrevLocations,
+	TConstArrayView<FVector> Locations, TConstArrayView<FVector2f> Extents, TArray<FFluidInteractionForceSource>& OutSources)
+{
+	OutSources.Reset(Locations.Num());
+
+	if (Params.DeltaTime <= 0.0f)
+	{
+		return;
+	}
+
+	const double Width = FMath::Max(Params.BoundsExtent.X * 2.0, 1.0);
+	const double Height = FMath::Max(Params.BoundsExtent.Y * 2.0, 1.0);
+	const float InvDeltaTime = 1.0f / Params.DeltaTime;
+	const float SimResolution = static_cast<float>(Params.SimResolution);
+
+	for (int32 Index = 0; Index < Locations.Num(); ++Index)
+	{
+		const FVector& Location = Locations[Index];
+
+		// World → Simulation UV (V는 -Y 방향)
+		const FVector2f PositionUV(
+			static_cast<float>((Location.X - Params.BoundsOrigin.X + Params.BoundsExtent.X) / Width),
+			1.0f - static_cast<float>((Location.Y - Params.BoundsOrigin.Y + Params.BoundsExtent.Y) / Height));
+
+		if (PositionUV.X < 0.0f || PositionUV.X > 1.0f || PositionUV.Y < 0.0f || PositionUV.Y > 1.0f)
+		{
+			continue;
+		}
+
+		const FVector Velocity = (Location - PrevLocations[Index]) * InvDeltaTime;
+		if (Velocity.SizeSquared2D() <= 1e-3)
+		{
+			continue;
+		}
+
+		// 속도를 volume 내 density field에서의 비율로 치환 (cell/s)
+		const FVector2f SimVelocity(
+			static_cast<float>(Velocity.X / Width) * SimResolution,
+			static_cast<float>(-Velocity.Y / Height) * SimResolution);
+
+		const FVector2f Force = SimVelocity * Params.ForceMultiplier;
+
+		const FVector2f RadiusUV(
+			FMath::Max(Extents[Index].X * Params.RadiusMultiplier, 1.0f) / static_cast<float>(Width),
+			FMath::Max(Extents[Index].Y * Params.RadiusMultiplier, 1.0f) / static_cast<float>(Height));
+
+		// 진행 방향 앞쪽에 force (actor가 밀어내는 위치)
+		const FVector2f MoveDirUV = SimVelocity.GetSafeNormal();
+		const FVector2f ForwardPositionUV(
+			FMath::Clamp(PositionUV.X + MoveDirUV.X * RadiusUV.X * 2.5f, 0.0f, 1.0f),
+			FMath::Clamp(PositionUV.Y + MoveDirUV.Y * RadiusUV.Y * 2.5f, 0.0f, 1.0f));
+
+		// 이번 스텝의 이동 경로 (Prev → Current) 전체를 선분 source로, 순간이동은 점으로 처리
+		const FVector Displacement = PrevLocations[Index] - Location;
+		FVector2f SweepOffsetUV(
+			static_cast<float>(Displacement.X / Width),
+			static_cast<float>(-Displacement.Y / Height));
+		if (SweepOffsetUV.SizeSquared() > FMath::Square(MaxSweepLengthUV))
+		{
+			SweepOffsetUV = FVector2f::ZeroVector;
+		}
+
+		// 선분 Gaussian의 적분(2pi + sqrt(2pi) * L, L = Radius로 나눈 길이)이 점과 같도록 force를 나눔
+		const float SweepLength = FVector2f(SweepOffsetUV.X / RadiusUV.X, SweepOffsetUV.Y / RadiusUV.Y).Size();
+		const float SweepForceScale = 1.0f / (1.0f + SweepLength / FMath::Sqrt(UE_TWO_PI));
+
+		FFluidInteractionForceSource& Source = OutSources.AddDefaulted_GetRef();
+		Source.PositionRadius = FVector4f(ForwardPositionUV.X, ForwardPositionUV.Y, RadiusUV.X, RadiusUV.Y);
+		Source.ForceDensity = FVector4f(Force.X * SweepForceScale, Force.Y * SweepForceScale, 0.0f, 0.0f);
+		Source.SweepOffset = FVector4f(SweepOffsetUV.X, SweepOffsetUV.Y, 0.0f, 0.0f);
+	}
+}
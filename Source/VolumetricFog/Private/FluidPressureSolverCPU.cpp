@@ -0,0 +1,411 @@
+#include "FluidPressureSolverCPU.h"
+
+#include "Async/ParallelFor.h"
+
+namespace FluidPressureSolverCPU
+{
+	FORCEINLINE int32 ClampedIndex(int32 X, int32 Y, int32 Resolution)
+	{
+		X = FMath::Clamp(X, 0, Resolution - 1);
+		Y = FMath::Clamp(Y, 0, Resolution - 1);
+		return Y * Resolution + X;
+	}
+	
+	/** FluidPressureSmooth.usf */
+	void Smooth(TArray<float>& Pressure, TArray<float>& Scratch, TConstArrayView<float> Rhs, int32 Resolution, float Dx, int32 NumIterations)
+	{
+		const float Alpha = -(Dx * Dx);
+		Scratch.SetNumUninitialized(Pressure.Num());
+		
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			for (int32 Y = 0; Y < Resolution; ++Y)
+			{
+				for (int32 X = 0; X < Resolution; ++X)
+				{
+					const float Left = Pressure[ClampedIndex(X - 1, Y, Resolution)];
+					const float Right = Pressure[ClampedIndex(X + 1, Y, Resolution)];
+					const float Top = Pressure[ClampedIndex(X, Y - 1, Resolution)];
+					const float Bottom = Pressure[ClampedIndex(X, Y + 1, Resolution)];
+					
+					const int32 Index = Y * Resolution + X;
+					const float Jacobi = (Left + Right + Top + Bottom + Alpha * Rhs[Index]) * 0.25f;
+					Scratch[Index] = FMath::Lerp(Pressure[Index], Jacobi, FluidMultigrid::SmoothWeight);
+				}
+			}
+			Swap(Pressure, Scratch);
+		}
+	}
+	
+	/** FluidPressureRestrict.usf */
+	void Restrict(TConstArrayView<float> Fine, int32 FineResolution, TArray<float>& OutCoarse, int32 CoarseResolution)
+	{
+		OutCoarse.SetNumUninitialized(CoarseResolution * CoarseResolution);
+		
+		for (int32 Y = 0; Y < CoarseResolution; ++Y)
+		{
+			for (int32 X = 0; X < CoarseResolution; ++X)
+			{
+				const int32 FX0 = FMath::Min(X * 2, FineResolution - 1);
+				const int32 FX1 = FMath::Min(X * 2 + 1, FineResolution - 1);
+				const int32 FY0 = FMath::Min(Y * 2, FineResolution - 1);
+				const int32 FY1 = FMath::Min(Y * 2 + 1, FineResolution - 1);
+				
+				const float A = Fine[FY0 * FineResolution + FX0];
+				const float B = Fine[FY0 * FineResolution + FX1];
+				const float C = Fine[FY1 * FineResolution + FX0];
+				const float D = Fine[FY1 * FineResolution + FX1];
+				
+				OutCoarse[Y * CoarseResolution + X] = (A + B + C + D) * 0.25f;
+			}
+		}
+	}
+	
+	/** FluidPressureProlongate.usf (Bilinear, Clamp Sampler) */
+	void ProlongateAdd(TArray<float>& Fine, int32 FineResolution, TConstArrayView<float> Coarse, int32 CoarseResolution)
+	{
+		for (int32 Y = 0; Y < FineResolution; ++Y)
+		{
+			for (int32 X = 0; X < FineResolution; ++X)
+			{
+				// Coarse texel 좌표 (texel 중심 기준)
+				const float CX = (static_cast<float>(X) + 0.5f) * 0.5f - 0.5f;
+				const float CY = (static_cast<float>(Y) + 0.5f) * 0.5f - 0.5f;
+				
+				const int32 X0 = FMath::FloorToInt32(CX);
+				const int32 Y0 = FMath::FloorToInt32(CY);
+				const float FracX = CX - static_cast<float>(X0);
+				const float FracY = CY - static_cast<float>(Y0);
+				
+				const float C00 = Coarse[ClampedIndex(X0, Y0, CoarseResolution)];
+				const float C10 = Coarse[ClampedIndex(X0 + 1, Y0, CoarseResolution)];
+				const float C01 = Coarse[ClampedIndex(X0, Y0 + 1, CoarseResolution)];
+				const float C11 = Coarse[ClampedIndex(X0 + 1, Y0 + 1, CoarseResolution)];
+				
+				const float Correction = FMath::Lerp(
+					FMath::Lerp(C00, C10, FracX),
+					FMath::Lerp(C01, C11, FracX),
+					FracY);
+				
+				Fine[Y * FineResolution + X] += Correction;
+			}
+		}
+	}
+}
+
+void FFluidPressureSolverCPU::JacobiRow(const float* Input, const float* Prev, float* Output, int32 Y,
+	int32 Resolution, float Alpha, float InvBeta)
+{
+	JacobiRowSpan(Input, Prev, Output, Y, 0, Resolution, Resolution, Alpha, InvBeta);
+}
+
+void FFluidPressureSolverCPU::JacobiRowSpan(const float* Input, const float* Prev, float* Output, int32 Y,
+	int32 XBegin, int32 XEnd, int32 Resolution, float Alpha, float InvBeta)
+{
+	using namespace FluidPressureSolverCPU;
+	
+	const float* Row = Input + Y * Resolution;
+	const float* TopRow = Input + FMath::Max(Y - 1, 0) * Resolution;
+	const float* BottomRow = Input + FMath::Min(Y + 1, Resolution - 1) * Resolution;
+	const float* PrevRow = Prev + Y * Resolution;
+	float* OutputRow = Output + Y * Resolution;
+	
+	const VectorRegister4Float AlphaVec = VectorSetFloat1(Alpha);
+	const VectorRegister4Float InvBetaVec = VectorSetFloat1(InvBeta);
+	
+	ForEachRowSpan(XBegin, XEnd, Resolution,
+		[&](int32 X)
+		{
+			const float Left = Row[FMath::Max(X - 1, 0)];
+			const float Right = Row[FMath::Min(X + 1, Resolution - 1)];
+			const float Top = TopRow[X];
+			const float Bottom = BottomRow[X];
+			
+			OutputRow[X] = (Left + Right + Top + Bottom + Alpha * PrevRow[X]) * InvBeta;
+		},
+		[&](int32 X)
+		{
+			const VectorRegister4Float Sum = VectorAdd(VectorAdd(VectorAdd(
+				VectorLoad(Row + X - 1), VectorLoad(Row + X + 1)), VectorLoad(TopRow + X)), VectorLoad(BottomRow + X));
+			
+			VectorStore(VectorMultiply(VectorAdd(Sum, VectorMultiply(AlphaVec, VectorLoad(PrevRow + X))), InvBetaVec), OutputRow + X);
+		});
+}
+
+void FFluidPressureSolverCPU::Jacobi(TArray<float>& Pressure, TConstArrayView<float> Divergence, int32 Resolution,
+	int32 NumIterations)
+{
+	const float Dx = 1.0f / static_cast<float>(Resolution);
+	const float Alpha = -(Dx * Dx);
+	const float InvBeta = 0.25f;
+	
+	TArray<float> Next;
+	Next.SetNumUninitialized(Pressure.Num());
+	
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		ParallelFor(Resolution, [&](int32 Y)
+		{
+			JacobiRow(Pressure.GetData(), Divergence.GetData(), Next.GetData(), Y, Resolution, Alpha, InvBeta);
+		});
+		Swap(Pressure, Next);
+	}
+}
+
+void FFluidPressureSolverCPU::JacobiTiled(TArray<float>& Pressure, TConstArrayView<float> Divergence,
+	int32 Resolution, int32 NumIterations, int32 IterationsPerDispatch)
+{
+	using namespace FluidPressureSolverCPU;
+	
+	constexpr int32 TileSize = 8;
+	const int32 Halo = FMath::Max(IterationsPerDispatch, 1);
+	const int32 SharedSize = TileSize + 2 * Halo;
+	const int32 NumTiles = FMath::DivideAndRoundUp(Resolution, TileSize);
+	
+	const float Dx = 1.0f / static_cast<float>(Resolution);
+	const float Alpha = -(Dx * Dx);
+	const float InvBeta = 0.25f;
+	
+	TArray<float> Next;
+	Next.SetNumUninitialized(Pressure.Num());
+	
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration += Halo)
+	{
+		const int32 NumFused = FMath::Min(NumIterations - Iteration, Halo);
+		
+		// Thread group 하나 = tile 하나
+		ParallelFor(NumTiles * NumTiles, [&](int32 TileIndex)
+		{
+			const int32 OriginX = (TileIndex % NumTiles) * TileSize - Halo;
+			const int32 OriginY = (TileIndex / NumTiles) * TileSize - Halo;
+			
+			// groupshared
+			TArray<float, TInlineAllocator<256>> Shared[2];
+			TArray<float, TInlineAllocator<256>> SharedPrev;
+			Shared[0].SetNumUninitialized(SharedSize * SharedSize);
+			Shared[1].SetNumUninitialized(SharedSize * SharedSize);
+			SharedPrev.SetNumUninitialized(SharedSize * SharedSize);
+			
+			for (int32 Index = 0; Index < SharedSize * SharedSize; ++Index)
+			{
+				const int32 Global = ClampedIndex(OriginX + Index % SharedSize, OriginY + Index / SharedSize, Resolution);
+				Shared[0][Index] = Pressure[Global];
+				SharedPrev[Index] = Divergence[Global];
+			}
+			
+			auto SharedAt = [&](const TArray<float, TInlineAllocator<256>>& Values, int32 X, int32 Y)
+			{
+				X = FMath::Clamp(X, 0, Resolution - 1);
+				Y = FMath::Clamp(Y, 0, Resolution - 1);
+				return Values[(Y - OriginY) * SharedSize + (X - OriginX)];
+			};
+			
+			int32 Cur = 0;
+			for (int32 Fused = 0; Fused < NumFused; ++Fused)
+			{
+				const int32 Margin = Halo - (NumFused - 1 - Fused);
+				
+				for (int32 LocalY = Margin; LocalY < SharedSize - Margin; ++LocalY)
+				{
+					for (int32 LocalX = Margin; LocalX < SharedSize - Margin; ++LocalX)
+					{
+						const int32 Index = LocalY * SharedSize + LocalX;
+						const int32 X = OriginX + LocalX;
+						const int32 Y = OriginY + LocalY;
+						
+						if (X < 0 || Y < 0 || X >= Resolution || Y >= Resolution)
+						{
+							Shared[1 - Cur][Index] = Shared[Cur][Index];
+							continue;
+						}
+						
+						const float Left = SharedAt(Shared[Cur], X - 1, Y);
+						const float Right = SharedAt(Shared[Cur], X + 1, Y);
+						const float Top = SharedAt(Shared[Cur], X, Y - 1);
+						const float Bottom = SharedAt(Shared[Cur], X, Y + 1);
+						
+						Shared[1 - Cur][Index] = (Left + Right + Top + Bottom + Alpha * SharedPrev[Index]) * InvBeta;
+					}
+				}
+				Cur = 1 - Cur;
+			}
+			
+			for (int32 LocalY = 0; LocalY < TileSize; ++LocalY)
+			{
+				for (int32 LocalX = 0; LocalX < TileSize; ++LocalX)
+				{
+					const int32 X = OriginX + Halo + LocalX;
+					const int32 Y = OriginY + Halo + LocalY;
+					if (X < Resolution && Y < Resolution)
+					{
+						Next[Y * Resolution + X] = Shared[Cur][(LocalY + Halo) * SharedSize + LocalX + Halo];
+					}
+				}
+			}
+		});
+		Swap(Pressure, Next);
+	}
+}
+
+void FFluidPressureSolverCPU::RedBlackSOR(TArray<float>& Pressure, TConstArrayView<float> Divergence,
+	int32 Resolution, int32 NumIterations, float Omega)
+{
+	using namespace FluidPressureSolverCPU;
+	
+	const float Dx = 1.0f / static_cast<float>(Resolution);
+	const float Alpha = -(Dx * Dx);
+	
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		for (int32 Parity = 0; Parity < 2; ++Parity)
+		{
+			// 같은 색의 셀끼리는 서로 의존하지 않으므로 row 단위로 병렬 처리
+			ParallelFor(Resolution, [&](int32 Y)
+			{
+				for (int32 X = (Y + Parity) & 1; X < Resolution; X += 2)
+				{
+					const float Left = Pressure[ClampedIndex(X - 1, Y, Resolution)];
+					const float Right = Pressure[ClampedIndex(X + 1, Y, Resolution)];
+					const float Top = Pressure[ClampedIndex(X, Y - 1, Resolution)];
+					const float Bottom = Pressure[ClampedIndex(X, Y + 1, Resolution)];
+					
+					const int32 Index = Y * Resolution + X;
+					const float GaussSeidel = (Left + Right + Top + Bottom + Alpha * Divergence[Index]) * 0.25f;
+					Pressure[Index] = FMath::Lerp(Pressure[Index], GaussSeidel, Omega);
+				}
+			});
+		}
+	}
+}
+
+void FFluidPressureSolverCPU::MultigridVCycle(TArray<float>& Pressure, TConstArrayView<float> Divergence,
+	int32 Resolution, int32 NumVCycles, int32 NumSmoothIterations)
+{
+	using namespace FluidPressureSolverCPU;
+	
+	struct FLevel
+	{
+		TArray<float> Pressure;
+		TArray<float> Rhs;
+		TArray<float> Residual;
+		int32 Resolution = 0;
+		float Dx = 0.0f;
+	};
+	
+	TArray<FLevel, TInlineAllocator<FluidMultigrid::MaxLevels>> Levels;
+	{
+		FLevel& Fine = Levels.AddDefaulted_GetRef();
+		Fine.Resolution = Resolution;
+		Fine.Dx = 1.0f / static_cast<float>(Resolution);
+		Fine.Rhs = TArray<float>(Divergence.GetData(), Divergence.Num());
+	}
+	
+	while (Levels.Num() < FluidMultigrid::MaxLevels && Levels.Last().Resolution > FluidMultigrid::MinResolution)
+	{
+		const int32 CoarseRes = FMath::DivideAndRoundUp(Levels.Last().Resolution, 2);
+		const float CoarseDx = Levels.Last().Dx * 2.0f;
+		
+		FLevel& Coarse = Levels.AddDefaulted_GetRef();
+		Coarse.Resolution = CoarseRes;
+		Coarse.Dx = CoarseDx;
+	}
+	
+	Swap(Levels[0].Pressure, Pressure);
+	TArray<float> Scratch;
+	
+	for (int32 Cycle = 0; Cycle < NumVCycles; ++Cycle)
+	{
+		for (int32 LevelIndex = 1; LevelIndex < Levels.Num(); ++LevelIndex)
+		{
+			FLevel& Level = Levels[LevelIndex];
+			Level.Pressure.Reset();
+			Level.Pressure.SetNumZeroed(Level.Resolution * Level.Resolution);
+		}
+		
+		// Down
+		for (int32 LevelIndex = 0; LevelIndex < Levels.Num() - 1; ++LevelIndex)
+		{
+			FLevel& Level = Levels[LevelIndex];
+			FLevel& Coarse = Levels[LevelIndex + 1];
+			
+			Smooth(Level.Pressure, Scratch, Level.Rhs, Level.Resolution, Level.Dx, NumSmoothIterations);
+			ComputeResidual(Level.Pressure, Level.Rhs, Level.Resolution, Level.Dx, Level.Residual);
+			Restrict(Level.Residual, Level.Resolution, Coarse.Rhs, Coarse.Resolution);
+		}
+		
+		// Coarsest
+		{
+			FLevel& Coarsest = Levels.Last();
+			Smooth(Coarsest.Pressure, Scratch, Coarsest.Rhs, Coarsest.Resolution, Coarsest.Dx,
+				Levels.Num() > 1 ? FluidMultigrid::CoarsestIterations : NumSmoothIterations);
+		}
+		
+		// Up
+		for (int32 LevelIndex = Levels.Num() - 2; LevelIndex >= 0; --LevelIndex)
+		{
+			FLevel& Level = Levels[LevelIndex];
+			const FLevel& Coarse = Levels[LevelIndex + 1];
+			
+			ProlongateAdd(Level.Pressure, Level.Resolution, Coarse.Pressure, Coarse.Resolution);
+			Smooth(Level.Pressure, Scratch, Level.Rhs, Level.Resolution, Level.Dx, NumSmoothIterations);
+		}
+	}
+	
+	Swap(Levels[0].Pressure, Pressure);
+}
+
+void FFluidPressureSolverCPU::ComputeResidual(TConstArrayView<float> Pressure, TConstArrayView<float> Rhs,
+	int32 Resolution, float Dx, TArray<float>& OutResidual)
+{
+	using namespace FluidPressureSolverCPU;
+	
+	const float InvDxSquared = 1.0f / (Dx * Dx);
+	OutResidual.SetNumUninitialized(Resolution * Resolution);
+	
+	for (int32 Y = 0; Y < Resolution; ++Y)
+	{
+		for (int32 X = 0; X < Resolution; ++X)
+		{
+			const float Left = Pressure[ClampedIndex(X - 1, Y, Resolution)];
+			const float Right = Pressure[ClampedIndex(X + 1, Y, Resolution)];
+			const float Top = Pressure[ClampedIndex(X, Y - 1, Resolution)];
+			const float Bottom = Pressure[ClampedIndex(X, Y + 1, Resolution)];
+			
+			const int32 Index = Y * Resolution + X;
+			const float Laplacian = (Left + Right + Top + Bottom - 4.0f * Pressure[Index]) * InvDxSquared;
+			OutResidual[Index] = Rhs[Index] - Laplacian;
+		}
+	}
+}
+
+float FFluidPressureSolverCPU::ComputeResidualNorm(TConstArrayView<float> Pressure, TConstArrayView<float> Divergence,
+	int32 Resolution)
+{
+	TArray<float> Residual;
+	ComputeResidual(Pressure, Divergence, Resolution, 1.0f / static_cast<float>(Resolution), Residual);
+	
+	double SumSquared = 0.0;
+	for (const float R : Residual)
+	{
+		SumSquared += static_cast<double>(R) * R;
+	}
+	
+	return static_cast<float>(FMath::Sqrt(SumSquared / FMath::Max(Residual.Num(), 1)));
+}
+
+float FFluidPressureSolverCPU::ComputeRelativeResidual(TConstArrayView<float> Pressure, TConstArrayView<float> Divergence,
+	int32 Resolution)
+{
+	TArray<float> Residual;
+	ComputeResidual(Pressure, Divergence, Resolution, 1.0f / static_cast<float>(Resolution), Residual);
+	
+	float MaxResidual = 0.0f;
+	float MaxRhs = 0.0f;
+	for (int32 Index = 0; Index < Residual.Num(); ++Index)
+	{
+		MaxResidual = FMath::Max(MaxResidual, FMath::Abs(Residual[Index]));
+		MaxRhs = FMath::Max(MaxRhs, FMath::Abs(Divergence[Index]));
+	}
+	
+	return MaxResidual / FMath::Max(MaxRhs, UE_SMALL_NUMBER);
+}
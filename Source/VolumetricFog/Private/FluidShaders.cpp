@@ -2,8 +2,23 @@
 
 IMPLEMENT_GLOBAL_SHADER(FFluidAdvectCS, "/VolumetricFog/FluidAdvect.usf", "MainCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FFluidAdvectVelocityCS, "/VolumetricFog/FluidAdvectVelocity.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidMacCormackCS, "/VolumetricFog/FluidMacCormack.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidMacCormackVelocityCS, "/VolumetricFog/FluidMacCormackVelocity.usf", "MainCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FFluidDensityMaintenanceCS, "/VolumetricFog/FluidDensityMaintenance.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidDensityDownsampleCS, "/VolumetricFog/FluidDensityDownsample.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidDensityMaxMipCS, "/VolumetricFog/FluidDensityMaxMip.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidResampleCS, "/VolumetricFog/FluidResample.usf", "MainCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FFluidDiffuseCS, "/VolumetricFog/FluidDiffuse.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidDiffuseTiledCS, "/VolumetricFog/FluidDiffuseTiled.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidTileClassifyCS, "/VolumetricFog/FluidTileClassify.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidTileCompactCS, "/VolumetricFog/FluidTileCompact.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidTileClearCS, "/VolumetricFog/FluidTileClear.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidPressureRedBlackCS, "/VolumetricFog/FluidPressureRedBlack.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidPressureSmoothCS, "/VolumetricFog/FluidPressureSmooth.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidPressureResidualCS, "/VolumetricFog/FluidPressureResidual.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidPressureResidualReduceCS, "/VolumetricFog/FluidPressureResidualReduce.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidPressureRestrictCS, "/VolumetricFog/FluidPressureRestrict.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFluidPressureProlongateCS, "/VolumetricFog/FluidPressureProlongate.usf", "MainCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FFluidDiffuseVelocityCS, "/VolumetricFog/FluidDiffuseVelocity.usf", "MainCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FFluidForceCS, "/VolumetricFog/FluidForce.usf", "MainCS", SF_Compute);
 IMPLEMENT_GLOBAL_SHADER(FFluidDivergenceCS, "/VolumetricFog/FluidDivergence.usf", "MainCS", SF_Compute);
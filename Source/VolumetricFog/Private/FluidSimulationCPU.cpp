@@ -0,0 +1,1035 @@
+#include "FluidSimulationCPU.h"
+
+#include "FluidInteractionTracker.h"
+#include "FluidPressureSolverCPU.h"
+#include "FluidShaders.h"
+#include "Async/ParallelFor.h"
+#include "Math/Float16.h"
+
+DECLARE_CYCLE_STAT(TEXT("VFF CPU Simulation Step"), STAT_VFF_CPUSimulationStep, STATGROUP_VolumetricFog);
+DECLARE_CYCLE_STAT(TEXT("VFF Interaction Force Binning"), STAT_VFF_InteractionForceBinning, STATGROUP_VolumetricFog);
+
+namespace FluidSimulationCPU
+{
+	/** SF_Bilinear + AM_Clamp */
+	FORCEINLINE float SampleBilinearClamp(const float* Values, int32 Resolution, float U, float V)
+	{
+		const float X = U * static_cast<float>(Resolution) - 0.5f;
+		const float Y = V * static_cast<float>(Resolution) - 0.5f;
+		const float FloorX = FMath::FloorToFloat(X);
+		const float FloorY = FMath::FloorToFloat(Y);
+		const float FracX = X - FloorX;
+		const float FracY = Y - FloorY;
+		
+		const int32 X0 = FMath::Clamp(static_cast<int32>(FloorX), 0, Resolution - 1);
+		const int32 Y0 = FMath::Clamp(static_cast<int32>(FloorY), 0, Resolution - 1);
+		const int32 X1 = FMath::Clamp(static_cast<int32>(FloorX) + 1, 0, Resolution - 1);
+		const int32 Y1 = FMath::Clamp(static_cast<int32>(FloorY) + 1, 0, Resolution - 1);
+		
+		const float Top = FMath::Lerp(Values[Y0 * Resolution + X0], Values[Y0 * Resolution + X1], FracX);
+		const float Bottom = FMath::Lerp(Values[Y1 * Resolution + X0], Values[Y1 * Resolution + X1], FracX);
+		return FMath::Lerp(Top, Bottom, FracY);
+	}
+	
+	/** AM_Mirror */
+	FORCEINLINE int32 MirrorIndex(int32 Index, int32 Size)
+	{
+		const int32 Period = 2 * Size;
+		int32 Mirrored = Index % Period;
+		Mirrored = Mirrored < 0 ? Mirrored + Period : Mirrored;
+		return Mirrored < Size ? Mirrored : Period - 1 - Mirrored;
+	}
+	
+	/** SF_Bilinear + AM_Mirror (Noise 전용, Width x Height) */
+	FORCEINLINE float SampleBilinearMirror(const float* Values, int32 Width, int32 Height, float U, float V)
+	{
+		const float X = U * static_cast<float>(Width) - 0.5f;
+		const float Y = V * static_cast<float>(Height) - 0.5f;
+		const float FloorX = FMath::FloorToFloat(X);
+		const float FloorY = FMath::FloorToFloat(Y);
+		const float FracX = X - FloorX;
+		const float FracY = Y - FloorY;
+		
+		const int32 X0 = MirrorIndex(static_cast<int32>(FloorX), Width);
+		const int32 Y0 = MirrorIndex(static_cast<int32>(FloorY), Height);
+		const int32 X1 = MirrorIndex(static_cast<int32>(FloorX) + 1, Width);
+		const int32 Y1 = MirrorIndex(static_cast<int32>(FloorY) + 1, Height);
+		
+		const float Top = FMath::Lerp(Values[Y0 * Width + X0], Values[Y0 * Width + X1], FracX);
+		const float Bottom = FMath::Lerp(Values[Y1 * Width + X0], Values[Y1 * Width + X1], FracX);
+		return FMath::Lerp(Top, Bottom, FracY);
+	}
+	
+	/** FluidForceSources.ush GetFluidForceSourceDistanceSquared: 선분까지의 (거리 / Radius)^2 */
+	FORCEINLINE float GetForceSourceDistanceSquared(const FFluidInteractionForceSource& Source, float U, float V)
+	{
+		const FVector2f InvRadius(1.0f / FMath::Max(Source.PositionRadius.Z, 1e-4f), 1.0f / FMath::Max(Source.PositionRadius.W, 1e-4f));
+		const FVector2f P((U - Source.PositionRadius.X) * InvRadius.X, (V - Source.PositionRadius.Y) * InvRadius.Y);
+		const FVector2f SweepDir(Source.SweepOffset.X * InvRadius.X, Source.SweepOffset.Y * InvRadius.Y);
+		
+		const float T = FMath::Clamp(FVector2f::DotProduct(P, SweepDir) / FMath::Max(SweepDir.SizeSquared(), 1e-8f), 0.0f, 1.0f);
+		return (P - T * SweepDir).SizeSquared();
+	}
+	
+	/** Source의 cutoff 범위가 UV 사각형에 걸치는지 (선분과 사각형 사이 최소 거리) */
+	bool ForceSourceOverlapsRect(const FFluidInteractionForceSource& Source, const FVector2f& RectMin, const FVector2f& RectMax)
+	{
+		const FVector2f Position(Source.PositionRadius.X, Source.PositionRadius.Y);
+		const FVector2f InvRadius(1.0f / FMath::Max(Source.PositionRadius.Z, 1e-4f), 1.0f / FMath::Max(Source.PositionRadius.W, 1e-4f));
+		const FVector2f Min = (RectMin - Position) * InvRadius;
+		const FVector2f Max = (RectMax - Position) * InvRadius;
+		const FVector2f SweepDir = FVector2f(Source.SweepOffset.X, Source.SweepOffset.Y) * InvRadius;
+		const float SweepLengthSquared = FMath::Max(SweepDir.SizeSquared(), 1e-8f);
+		
+		auto RectDistanceSquared = [&Min, &Max](const FVector2f& P)
+		{
+			return FVector2f::DistSquared(P, FVector2f(FMath::Clamp(P.X, Min.X, Max.X), FMath::Clamp(P.Y, Min.Y, Max.Y)));
+		};
+		
+		// 후보: 양 끝점, 꼭짓점 투영, 사각형 경계를 지나는 점
+		float DistanceSquared = FMath::Min(RectDistanceSquared(FVector2f::ZeroVector), RectDistanceSquared(SweepDir));
+		
+		const FVector2f Corners[4] = { Min, FVector2f(Max.X, Min.Y), FVector2f(Min.X, Max.Y), Max };
+		for (const FVector2f& Corner : Corners)
+		{
+			const float T = FMath::Clamp(FVector2f::DotProduct(Corner, SweepDir) / SweepLengthSquared, 0.0f, 1.0f);
+			DistanceSquared = FMath::Min(DistanceSquared, RectDistanceSquared(T * SweepDir));
+		}
+		
+		for (int32 Axis = 0; Axis < 2; ++Axis)
+		{
+			if (FMath::Abs(SweepDir[Axis]) > 1e-8f)
+			{
+				const float TMin = FMath::Clamp(Min[Axis] / SweepDir[Axis], 0.0f, 1.0f);
+				const float TMax = FMath::Clamp(Max[Axis] / SweepDir[Axis], 0.0f, 1.0f);
+				DistanceSquared = FMath::Min(DistanceSquared, RectDistanceSquared(TMin * SweepDir));
+				DistanceSquared = FMath::Min(DistanceSquared, RectDistanceSquared(TMax * SweepDir));
+			}
+		}
+		
+		return DistanceSquared < FluidInteractionForceBins::CutoffSquared;
+	}
+	
+	/** 16-bit texture에 저장된 값 (round to nearest even) */
+	void QuantizeGrid(TArray<float>& Grid, EFluidTexturePrecision GridPrecision)
+	{
+		if (GridPrecision != EFluidTexturePrecision::Half)
+		{
+			return;
+		}
+		
+		for (float& Value : Grid)
+		{
+			Value = FFloat16(Value).GetFloat();
+		}
+	}
+	
+	/** FluidAdvect.usf: Output(x) = Source(x - v(x) * dt), row Y의 [XBegin, XEnd) */
+	void AdvectRow(const float* Source, float* Output, const float* VelocityX, const float* VelocityY,
+		int32 Resolution, float DeltaTime, int32 Y, int32 XBegin, int32 XEnd)
+	{
+		const float InvResolution = 1.0f / static_cast<float>(Resolution);
+		
+		for (int32 X = XBegin; X < XEnd; ++X)
+		{
+			const int32 Index = Y * Resolution + X;
+			const float U = (static_cast<float>(X) + 0.5f) * InvResolution;
+			const float V = (static_cast<float>(Y) + 0.5f) * InvResolution;
+			
+			// 셀 중심의 Bilinear sample = 해당 셀 값
+			const float PrevU = U - VelocityX[Index] * DeltaTime * InvResolution;
+			const float PrevV = V - VelocityY[Index] * DeltaTime * InvResolution;
+			
+			Output[Index] = SampleBilinearClamp(Source, Resolution, PrevU, PrevV);
+		}
+	}
+	
+	/** FluidMacCormack.usf, row Y의 [XBegin, XEnd) */
+	void MacCormackRow(const float* Source, const float* Predicted, float* Output, const float* VelocityX,
+		const float* VelocityY, int32 Resolution, float DeltaTime, int32 Y, int32 XBegin, int32 XEnd)
+	{
+		const float InvResolution = 1.0f / static_cast<float>(Resolution);
+		
+		for (int32 X = XBegin; X < XEnd; ++X)
+		{
+			const int32 Index = Y * Resolution + X;
+			const float U = (static_cast<float>(X) + 0.5f) * InvResolution;
+			const float V = (static_cast<float>(Y) + 0.5f) * InvResolution;
+			const float OffsetU = VelocityX[Index] * DeltaTime * InvResolution;
+			const float OffsetV = VelocityY[Index] * DeltaTime * InvResolution;
+			
+			const float Reversed = SampleBilinearClamp(Predicted, Resolution, U + OffsetU, V + OffsetV);
+			const float Corrected = Predicted[Index] + 0.5f * (Source[Index] - Reversed);
+			
+			// Limiter
+			const int32 BaseX = FMath::FloorToInt32((U - OffsetU) * static_cast<float>(Resolution) - 0.5f);
+			const int32 BaseY = FMath::FloorToInt32((V - OffsetV) * static_cast<float>(Resolution) - 0.5f);
+			const int32 X0 = FMath::Clamp(BaseX, 0, Resolution - 1);
+			const int32 X1 = FMath::Clamp(BaseX + 1, 0, Resolution - 1);
+			const int32 Y0 = FMath::Clamp(BaseY, 0, Resolution - 1);
+			const int32 Y1 = FMath::Clamp(BaseY + 1, 0, Resolution - 1);
+			
+			const float S00 = Source[Y0 * Resolution + X0];
+			const float S10 = Source[Y0 * Resolution + X1];
+			const float S01 = Source[Y1 * Resolution + X0];
+			const float S11 = Source[Y1 * Resolution + X1];
+			
+			Output[Index] = FMath::Clamp(Corrected,
+				FMath::Min(FMath::Min(S00, S10), FMath::Min(S01, S11)),
+				FMath::Max(FMath::Max(S00, S10), FMath::Max(S01, S11)));
+		}
+	}
+}
+
+void FFluidSimulationCPU::Init(int32 InResolution)
+{
+	Resolution = FMath::Max(InResolution, 1);
+	const int32 NumCells = Resolution * Resolution;
+	
+	for (TArray<float>* Grid : { &VelocityX, &VelocityY, &VelocityScratchX, &VelocityScratchY,
+		&TempVelocityX, &TempVelocityY, &Density, &DensityScratch, &DensityPredicted, &Pressure, &PressureScratch, &Divergence })
+	{
+		Grid->SetNumZeroed(NumCells);
+	}
+	
+	bBaseDensityInitialized = false;
+	bPressureHistoryValid = false;
+	AdaptivePressureIterations = 0;
+	LastPressureResidual = -1.0f;
+	
+	bActiveTilesThisStep = false;
+	bTileMaskValid = false;
+	PrevTileMask.Reset();
+	ActiveTileSpans.Reset();
+	LastActiveTileFraction = 1.0f;
+}
+
+void FFluidSimulationCPU::SetBaseDensityNoise(TArray<float> InValues, int32 InWidth, int32 InHeight)
+{
+	if (InWidth <= 0 || InHeight <= 0 || InValues.Num() != InWidth * InHeight)
+	{
+		BaseDensityNoise.Reset();
+		BaseDensityNoiseWidth = 0;
+		BaseDensityNoiseHeight = 0;
+		return;
+	}
+	
+	BaseDensityNoise = MoveTemp(InValues);
+	BaseDensityNoiseWidth = InWidth;
+	BaseDensityNoiseHeight = InHeight;
+}
+
+void FFluidSimulationCPU::SetDensity(TArray<float> InValues)
+{
+	if (InValues.Num() != Resolution * Resolution)
+	{
+		return;
+	}
+	
+	Density = MoveTemp(InValues);
+	FluidSimulationCPU::QuantizeGrid(Density, Precision.Density);
+}
+
+float FFluidSimulationCPU::SampleDensity(const FVector2f& UV) const
+{
+	if (Density.IsEmpty())
+	{
+		return 0.0f;
+	}
+	return FluidSimulationCPU::SampleBilinearClamp(Density.GetData(), Resolution, UV.X, UV.Y);
+}
+
+void FFluidSimulationCPU::Step(const FFluidSimulationParams& SimParams)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VFF_CPUSimulationStep);
+	
+	if (Resolution <= 0)
+	{
+		return;
+	}
+	
+	using namespace FluidSimulationCPU;
+	
+	const bool bMacCormack = SimParams.AdvectionMode == EFluidAdvectionMode::MacCormack;
+	
+	ForceBins.Build(SimParams.InteractionForceSources, Resolution);
+	BuildActiveTiles(SimParams);
+	
+	AdvectVelocity(SimParams.DeltaTime, bMacCormack);
+	
+	if (SimParams.Viscosity > 0.0f)
+	{
+		DiffuseVelocity(SimParams.DeltaTime, SimParams.Viscosity);
+	}
+	
+	ApplyForce(SimParams);
+	QuantizeGrid(VelocityX, Precision.Velocity);
+	QuantizeGrid(VelocityY, Precision.Velocity);
+	QuantizeGrid(Density, Precision.Density);
+	
+	ComputeDivergence();
+	QuantizeGrid(Divergence, Precision.Pressure);
+	
+	SolvePressure(SimParams);
+	
+	SubtractGradient();
+	QuantizeGrid(VelocityX, Precision.Velocity);
+	QuantizeGrid(VelocityY, Precision.Velocity);
+	
+	AdvectDensity(SimParams.DeltaTime, bMacCormack);
+	
+	if (SimParams.bEnableDensityMaintenance && !BaseDensityNoise.IsEmpty())
+	{
+		MaintainDensity(SimParams);
+		QuantizeGrid(Density, Precision.Density);
+	}
+}
+
+template<typename RowFuncType>
+void FFluidSimulationCPU::ForEachActiveRow(RowFuncType&& RowFunc) const
+{
+	if (!bActiveTilesThisStep)
+	{
+		ParallelFor(Resolution, [&](int32 Y)
+		{
+			RowFunc(Y, 0, Resolution);
+		});
+		return;
+	}
+	
+	ParallelFor(Resolution, [&](int32 Y)
+	{
+		for (const FIntPoint& Span : ActiveTileSpans[Y / FluidActiveTiles::TileSize])
+		{
+			RowFunc(Y, Span.X, Span.Y);
+		}
+	});
+}
+
+void FFluidSimulationCPU::ApplyInteractionForces(const FFluidSimulationParams& SimParams)
+{
+	ForceBins.Build(SimParams.InteractionForceSources, Resolution);
+	ApplyForce(SimParams);
+}
+
+float FFluidSimulationCPU::GetForceSourceDistanceSquared(const FFluidInteractionForceSource& Source, const FVector2f& UV)
+{
+	return FluidSimulationCPU::GetForceSourceDistanceSquared(Source, UV.X, UV.Y);
+}
+
+void FFluidSimulationCPU::BuildActiveTiles(const FFluidSimulationParams& SimParams)
+{
+	constexpr int32 TileSize = FluidActiveTiles::TileSize;
+	
+	// GPU와 같이 Density Maintenance가 켜져 있으면 dense
+	bActiveTilesThisStep = SimParams.bActiveTiles
+		&& !(SimParams.bEnableDensityMaintenance && !BaseDensityNoise.IsEmpty());
+	
+	if (!bActiveTilesThisStep)
+	{
+		bTileMaskValid = false;
+		LastActiveTileFraction = 1.0f;
+		return;
+	}
+	
+	const int32 NumTiles = FMath::DivideAndRoundUp(Resolution, TileSize);
+	const float InvResolution = 1.0f / static_cast<float>(Resolution);
+	const float DensityThreshold = SimParams.ActiveTileDensityThreshold;
+	const float VelocityThresholdSquared = FMath::Square(SimParams.ActiveTileVelocityThreshold);
+	
+	// FluidTileClassify.usf
+	TArray<uint8> TileMask;
+	TileMask.SetNumZeroed(NumTiles * NumTiles);
+	
+	ParallelFor(NumTiles, [&](int32 TileY)
+	{
+		for (int32 TileX = 0; TileX < NumTiles; ++TileX)
+		{
+			bool bActive = false;
+			
+			const int32 XEnd = FMath::Min((TileX + 1) * TileSize, Resolution);
+			const int32 YEnd = FMath::Min((TileY + 1) * TileSize, Resolution);
+			for (int32 Y = TileY * TileSize; Y < YEnd && !bActive; ++Y)
+			{
+				for (int32 X = TileX * TileSize; X < XEnd; ++X)
+				{
+					const int32 Index = Y * Resolution + X;
+					if (FMath::Abs(Density[Index]) > DensityThreshold
+						|| FMath::Square(VelocityX[Index]) + FMath::Square(VelocityY[Index]) > VelocityThresholdSquared)
+					{
+						bActive = true;
+						break;
+					}
+				}
+			}
+			
+			// Interaction force가 닿는 tile은 활성화 (ForceBins와 같은 tile 격자)
+			bActive |= ForceBins.GetTileSourceCount(TileY * NumTiles + TileX) > 0;
+			
+			TileMask[TileY * NumTiles + TileX] = bActive ? 1 : 0;
+		}
+	});
+	
+	// FluidTileCompact.usf (처음이거나 dense 스텝 이후에는 모든 tile을 이전에 활성이었던 것으로 간주)
+	if (!bTileMaskValid || PrevTileMask.Num() != NumTiles * NumTiles)
+	{
+		PrevTileMask.Init(1, NumTiles * NumTiles);
+		bTileMaskValid = true;
+	}
+	
+	const int32 Dilation = SimParams.ActiveTileDilation;
+	TArray<FIntPoint> RetiredTiles;
+	int32 NumActiveTiles = 0;
+	
+	ActiveTileSpans.SetNum(NumTiles);
+	for (int32 TileY = 0; TileY < NumTiles; ++TileY)
+	{
+		TArray<FIntPoint>& Spans = ActiveTileSpans[TileY];
+		Spans.Reset();
+		
+		for (int32 TileX = 0; TileX < NumTiles; ++TileX)
+		{
+			bool bActive = false;
+			for (int32 Y = FMath::Max(TileY - Dilation, 0); Y <= FMath::Min(TileY + Dilation, NumTiles - 1) && !bActive; ++Y)
+			{
+				for (int32 X = FMath::Max(TileX - Dilation, 0); X <= FMath::Min(TileX + Dilation, NumTiles - 1); ++X)
+				{
+					if (TileMask[Y * NumTiles + X])
+					{
+						bActive = true;
+						break;
+					}
+				}
+			}
+			
+			uint8& Prev = PrevTileMask[TileY * NumTiles + TileX];
+			if (bActive)
+			{
+				++NumActiveTiles;
+				
+				const int32 XBegin = TileX * TileSize;
+				const int32 XEnd = FMath::Min(XBegin + TileSize, Resolution);
+				if (!Spans.IsEmpty() && Spans.Last().Y == XBegin)
+				{
+					Spans.Last().Y = XEnd;
+				}
+				else
+				{
+					Spans.Emplace(XBegin, XEnd);
+				}
+			}
+			else if (Prev)
+			{
+				RetiredTiles.Emplace(TileX, TileY);
+			}
+			Prev = bActive ? 1 : 0;
+		}
+	}
+	
+	// FluidTileClear.usf (비활성 tile은 항상 0)
+	ParallelFor(RetiredTiles.Num(), [&](int32 RetiredIndex)
+	{
+		const FIntPoint Tile = RetiredTiles[RetiredIndex];
+		const int32 XBegin = Tile.X * TileSize;
+		const int32 Count = FMath::Min(XBegin + TileSize, Resolution) - XBegin;
+		const int32 YEnd = FMath::Min((Tile.Y + 1) * TileSize, Resolution);
+		
+		for (int32 Y = Tile.Y * TileSize; Y < YEnd; ++Y)
+		{
+			for (TArray<float>* Grid : { &VelocityX, &VelocityY, &VelocityScratchX, &VelocityScratchY, &TempVelocityX, &TempVelocityY,
+				&Density, &DensityScratch, &DensityPredicted, &Pressure, &PressureScratch, &Divergence })
+			{
+				FMemory::Memzero(Grid->GetData() + Y * Resolution + XBegin, Count * sizeof(float));
+			}
+		}
+	});
+	
+	LastActiveTileFraction = static_cast<float>(NumActiveTiles) / static_cast<float>(NumTiles * NumTiles);
+}
+
+void FFluidSimulationCPU::AdvectVelocity(float DeltaTime, bool bMacCormack)
+{
+	using namespace FluidSimulationCPU;
+	
+	// FluidAdvectVelocity.usf (두 성분 모두 advect 전 Velocity로 back-trace)
+	ForEachActiveRow([&](int32 Y, int32 XBegin, int32 XEnd)
+	{
+		AdvectRow(VelocityX.GetData(), VelocityScratchX.GetData(), VelocityX.GetData(), VelocityY.GetData(), Resolution, DeltaTime, Y, XBegin, XEnd);
+		AdvectRow(VelocityY.GetData(), VelocityScratchY.GetData(), VelocityX.GetData(), VelocityY.GetData(), Resolution, DeltaTime, Y, XBegin, XEnd);
+	});
+	
+	QuantizeGrid(VelocityScratchX, Precision.Velocity);
+	QuantizeGrid(VelocityScratchY, Precision.Velocity);
+	
+	if (bMacCormack)
+	{
+		// FluidMacCormackVelocity.usf (GPU처럼 TempVelocity를 사용, Viscosity보다 먼저 끝남)
+		ForEachActiveRow([&](int32 Y, int32 XBegin, int32 XEnd)
+		{
+			MacCormackRow(VelocityX.GetData(), VelocityScratchX.GetData(), TempVelocityX.GetData(), VelocityX.GetData(), VelocityY.GetData(), Resolution, DeltaTime, Y, XBegin, XEnd);
+			MacCormackRow(VelocityY.GetData(), VelocityScratchY.GetData(), TempVelocityY.GetData(), VelocityX.GetData(), VelocityY.GetData(), Resolution, DeltaTime, Y, XBegin, XEnd);
+		});
+		
+		Swap(VelocityX, TempVelocityX);
+		Swap(VelocityY, TempVelocityY);
+		QuantizeGrid(VelocityX, Precision.Velocity);
+		QuantizeGrid(VelocityY, Precision.Velocity);
+		return;
+	}
+	
+	Swap(VelocityX, VelocityScratchX);
+	Swap(VelocityY, VelocityScratchY);
+}
+
+void FFluidSimulationCPU::DiffuseVelocity(float DeltaTime, float Viscosity)
+{
+	const float Dx = 1.0f / static_cast<float>(Resolution);
+	const float A = DeltaTime * Viscosity / (Dx * Dx);
+	const float ViscAlpha = 1.0f / A;
+	const float ViscInvBeta = 1.0f / (4.0f + ViscAlpha);
+	
+	TempVelocityX = VelocityX;
+	TempVelocityY = VelocityY;
+	
+	// FluidDiffuseVelocity.usf (x, y 성분은 서로 독립)
+	for (int32 Iteration = 0; Iteration < 5; ++Iteration)
+	{
+		ForEachActiveRow([&](int32 Y, int32 XBegin, int32 XEnd)
+		{
+			FFluidPressureSolverCPU::JacobiRowSpan(VelocityX.GetData(), TempVelocityX.GetData(), VelocityScratchX.GetData(), Y, XBegin, XEnd, Resolution, ViscAlpha, ViscInvBeta);
+			FFluidPressureSolverCPU::JacobiRowSpan(VelocityY.GetData(), TempVelocityY.GetData(), VelocityScratchY.GetData(), Y, XBegin, XEnd, Resolution, ViscAlpha, ViscInvBeta);
+		});
+		
+		Swap(VelocityX, VelocityScratchX);
+		Swap(VelocityY, VelocityScratchY);
+		FluidSimulationCPU::QuantizeGrid(VelocityX, Precision.Velocity);
+		FluidSimulationCPU::QuantizeGrid(VelocityY, Precision.Velocity);
+	}
+}
+
+void FFluidSimulationCPU::ApplyForce(const FFluidSimulationParams& SimParams)
+{
+	const float InvResolution = 1.0f / static_cast<float>(Resolution);
+	const float DeltaTime = SimParams.DeltaTime;
+	const float Dissipation = SimParams.Dissipation;
+	constexpr int32 TileSize = FluidActiveTiles::TileSize;
+	
+	// FluidForce.usf (ForceBins가 모은 tile의 source만 평가)
+	ForEachActiveRow([&](int32 Y, int32 XBegin, int32 XEnd)
+	{
+		const float V = (static_cast<float>(Y) + 0.5f) * InvResolution;
+		
+		for (int32 TileX = XBegin / TileSize; TileX * TileSize < XEnd; ++TileX)
+		{
+			const int32 TileIndex = (Y / TileSize) * ForceBins.NumTiles + TileX;
+			const uint32* TileIndices = ForceBins.SourceIndices.GetData() + ForceBins.TileSourceOffsets[TileIndex];
+			const int32 TileSourceCount = ForceBins.GetTileSourceCount(TileIndex);
+			const int32 TileXBegin = FMath::Max(TileX * TileSize, XBegin);
+			const int32 TileXEnd = FMath::Min((TileX + 1) * TileSize, XEnd);
+			
+			for (int32 X = TileXBegin; X < TileXEnd; ++X)
+			{
+				const float U = (static_cast<float>(X) + 0.5f) * InvResolution;
+				const int32 Index = Y * Resolution + X;
+				
+				for (int32 BinIndex = 0; BinIndex < TileSourceCount; ++BinIndex)
+				{
+					const FFluidInteractionForceSource& Source = SimParams.InteractionForceSources[TileIndices[BinIndex]];
+					const float DistanceSquared = FluidSimulationCPU::GetForceSourceDistanceSquared(Source, U, V);
+					
+					if (DistanceSquared < FluidInteractionForceBins::CutoffSquared)
+					{
+						const float Influence = FMath::Exp(-0.5f * DistanceSquared);
+						VelocityX[Index] += Source.ForceDensity.X * Influence * DeltaTime;
+						VelocityY[Index] += Source.ForceDensity.Y * Influence * DeltaTime;
+					}
+				}
+			}
+		}
+		
+		// 밀도 감쇠
+		float* DensityRow = Density.GetData() + Y * Resolution;
+		for (int32 X = XBegin; X < XEnd; ++X)
+		{
+			DensityRow[X] *= Dissipation;
+		}
+	});
+}
+
+void FFluidSimulationCPU::ComputeDivergence()
+{
+	using namespace FluidPressureSolverCPU;
+	
+	const float HalfInvDx = 0.5f * static_cast<float>(Resolution);
+	const VectorRegister4Float HalfInvDxVec = VectorSetFloat1(HalfInvDx);
+	
+	// FluidDivergence.usf
+	ForEachActiveRow([&](int32 Y, int32 XBegin, int32 XEnd)
+	{
+		const float* RowX = VelocityX.GetData() + Y * Resolution;
+		const float* TopRowY = VelocityY.GetData() + FMath::Max(Y - 1, 0) * Resolution;
+		const float* BottomRowY = VelocityY.GetData() + FMath::Min(Y + 1, Resolution - 1) * Resolution;
+		float* OutputRow = Divergence.GetData() + Y * Resolution;
+		
+		ForEachRowSpan(XBegin, XEnd, Resolution,
+			[&](int32 X)
+			{
+				const float Left = RowX[FMath::Max(X - 1, 0)];
+				const float Right = RowX[FMath::Min(X + 1, Resolution - 1)];
+				OutputRow[X] = ((Right - Left) + (BottomRowY[X] - TopRowY[X])) * HalfInvDx;
+			},
+			[&](int32 X)
+			{
+				const VectorRegister4Float DiffX = VectorSubtract(VectorLoad(RowX + X + 1), VectorLoad(RowX + X - 1));
+				const VectorRegister4Float DiffY = VectorSubtract(VectorLoad(BottomRowY + X), VectorLoad(TopRowY + X));
+				VectorStore(VectorMultiply(VectorAdd(DiffX, DiffY), HalfInvDxVec), OutputRow + X);
+			});
+	});
+}
+
+void FFluidSimulationCPU::SolvePressure(const FFluidSimulationParams& SimParams)
+{
+	const bool bMultigrid = SimParams.PressureSolverMode == EFluidPressureSolverMode::Multigrid;
+	const bool bWarmStart = SimParams.bPressureWarmStart && bPressureHistoryValid;
+	
+	// AddSimulationPasses의 Pressure solve와 같은 반복 횟수 정책
+	const int32 MaxIterations = FMath::Max(bMultigrid ? SimParams.MultigridVCycles : SimParams.PressureIterations, 1);
+	int32 NumIterations = MaxIterations;
+	
+	if (SimParams.bPressureWarmStart)
+	{
+		int32& Adaptive = AdaptivePressureIterations;
+		Adaptive = Adaptive > 0 ? Adaptive : MaxIterations;
+		
+		if (LastPressureResidual >= 0.0f)
+		{
+			Adaptive = LastPressureResidual < SimParams.PressureResidualTolerance
+				? Adaptive - FMath::Max(1, Adaptive / 4)
+				: Adaptive + FMath::Max(1, Adaptive / 2);
+		}
+		
+		const int32 MinIterations = FMath::Clamp(SimParams.MinPressureIterations, 1, MaxIterations);
+		Adaptive = FMath::Clamp(Adaptive, MinIterations, MaxIterations);
+		NumIterations = Adaptive;
+	}
+	
+	if (!bWarmStart)
+	{
+		FMemory::Memzero(Pressure.GetData(), Pressure.Num() * sizeof(float));
+	}
+	
+	// 16-bit Pressure: GPU처럼 dispatch 결과가 texture에 저장될 때마다 반올림 (Fused Jacobi는 tile 내부가 32-bit)
+	const bool bHalfPressure = Precision.Pressure == EFluidTexturePrecision::Half;
+	const int32 IterationsPerStore = !bHalfPressure ? NumIterations
+		: SimParams.PressureSolverMode == EFluidPressureSolverMode::FusedJacobi ? FFluidDiffuseTiledCS::MaxIterationsPerDispatch : 1;
+	
+	for (int32 Iteration = 0; Iteration < NumIterations; Iteration += IterationsPerStore)
+	{
+		const int32 NumSweeps = FMath::Min(IterationsPerStore, NumIterations - Iteration);
+		
+		switch (SimParams.PressureSolverMode)
+		{
+		case EFluidPressureSolverMode::Multigrid:
+			FFluidPressureSolverCPU::MultigridVCycle(Pressure, Divergence, Resolution, NumSweeps, SimParams.MultigridSmoothIterations);
+			break;
+		case EFluidPressureSolverMode::RedBlackSOR:
+			FFluidPressureSolverCPU::RedBlackSOR(Pressure, Divergence, Resolution, NumSweeps, SimParams.SOROmega);
+			break;
+		case EFluidPressureSolverMode::Jacobi:
+			if (bActiveTilesThisStep)
+			{
+				// GPU와 같이 활성 tile만 갱신 (비활성 tile의 Pressure = 0)
+				const float Dx = 1.0f / static_cast<float>(Resolution);
+				for (int32 Sweep = 0; Sweep < NumSweeps; ++Sweep)
+				{
+					ForEachActiveRow([&](int32 Y, int32 XBegin, int32 XEnd)
+					{
+						FFluidPressureSolverCPU::JacobiRowSpan(Pressure.GetData(), Divergence.GetData(), PressureScratch.GetData(), Y, XBegin, XEnd, Resolution, -(Dx * Dx), 0.25f);
+					});
+					Swap(Pressure, PressureScratch);
+				}
+				break;
+			}
+			FFluidPressureSolverCPU::Jacobi(Pressure, Divergence, Resolution, NumSweeps);
+			break;
+		default:
+			// Fused Jacobi는 Jacobi와 같은 결과
+			FFluidPressureSolverCPU::Jacobi(Pressure, Divergence, Resolution, NumSweeps);
+			break;
+		}
+		
+		FluidSimulationCPU::QuantizeGrid(Pressure, Precision.Pressure);
+	}
+	
+	bPressureHistoryValid = true;
+	
+	LastPressureResidual = SimParams.bPressureWarmStart
+		? FFluidPressureSolverCPU::ComputeRelativeResidual(Pressure, Divergence, Resolution)
+		: -1.0f;
+}
+
+void FFluidSimulationCPU::SubtractGradient()
+{
+	using namespace FluidPressureSolverCPU;
+	
+	const float HalfInvDx = 0.5f * static_cast<float>(Resolution);
+	const VectorRegister4Float HalfInvDxVec = VectorSetFloat1(HalfInvDx);
+	
+	// FluidGradientSubtract.usf (in-place, Pressure만 읽으므로 안전)
+	ForEachActiveRow([&](int32 Y, int32 XBegin, int32 XEnd)
+	{
+		const float* Row = Pressure.GetData() + Y * Resolution;
+		const float* TopRow = Pressure.GetData() + FMath::Max(Y - 1, 0) * Resolution;
+		const float* BottomRow = Pressure.GetData() + FMath::Min(Y + 1, Resolution - 1) * Resolution;
+		float* RowX = VelocityX.GetData() + Y * Resolution;
+		float* RowY = VelocityY.GetData() + Y * Resolution;
+		
+		ForEachRowSpan(XBegin, XEnd, Resolution,
+			[&](int32 X)
+			{
+				const float Left = Row[FMath::Max(X - 1, 0)];
+				const float Right = Row[FMath::Min(X + 1, Resolution - 1)];
+				RowX[X] -= (Right - Left) * HalfInvDx;
+				RowY[X] -= (BottomRow[X] - TopRow[X]) * HalfInvDx;
+			},
+			[&](int32 X)
+			{
+				const VectorRegister4Float GradX = VectorMultiply(VectorSubtract(VectorLoad(Row + X + 1), VectorLoad(Row + X - 1)), HalfInvDxVec);
+				const VectorRegister4Float GradY = VectorMultiply(VectorSubtract(VectorLoad(BottomRow + X), VectorLoad(TopRow + X)), HalfInvDxVec);
+				VectorStore(VectorSubtract(VectorLoad(RowX + X), GradX), RowX + X);
+				VectorStore(VectorSubtract(VectorLoad(RowY + X), GradY), RowY + X);
+			});
+	});
+}
+
+void FFluidSimulationCPU::AdvectDensity(float DeltaTime, bool bMacCormack)
+{
+	using namespace FluidSimulationCPU;
+	
+	// FluidAdvect.usf
+	if (!bMacCormack)
+	{
+		ForEachActiveRow([&](int32 Y, int32 XBegin, int32 XEnd)
+		{
+			AdvectRow(Density.GetData(), DensityScratch.GetData(), VelocityX.GetData(), VelocityY.GetData(), Resolution, DeltaTime, Y, XBegin, XEnd);
+		});
+		Swap(Density, DensityScratch);
+		QuantizeGrid(Density, Precision.Density);
+		return;
+	}
+	
+	// FluidMacCormack.usf (보정이 주변 texel을 읽으므로 Predicted를 모두 채운 뒤 보정)
+	ForEachActiveRow([&](int32 Y, int32 XBegin, int32 XEnd)
+	{
+		AdvectRow(Density.GetData(), DensityPredicted.GetData(), VelocityX.GetData(), VelocityY.GetData(), Resolution, DeltaTime, Y, XBegin, XEnd);
+	});
+	QuantizeGrid(DensityPredicted, Precision.Density);
+	
+	ForEachActiveRow([&](int32 Y, int32 XBegin, int32 XEnd)
+	{
+		MacCormackRow(Density.GetData(), DensityPredicted.GetData(), DensityScratch.GetData(), VelocityX.GetData(), VelocityY.GetData(), Resolution, DeltaTime, Y, XBegin, XEnd);
+	});
+	Swap(Density, DensityScratch);
+	QuantizeGrid(Density, Precision.Density);
+}
+
+void FFluidSimulationCPU::AdvectScalarField(TConstArrayView<float> Source, TArray<float>& Output, TConstArrayView<float> InVelocityX,
+	TConstArrayView<float> InVelocityY, int32 InResolution, float DeltaTime, EFluidAdvectionMode AdvectionMode)
+{
+	using namespace FluidSimulationCPU;
+	
+	Output.SetNumUninitialized(InResolution * InResolution);
+	
+	if (AdvectionMode != EFluidAdvectionMode::MacCormack)
+	{
+		ParallelFor(InResolution, [&](int32 Y)
+		{
+			AdvectRow(Source.GetData(), Output.GetData(), InVelocityX.GetData(), InVelocityY.GetData(), InResolution, DeltaTime, Y, 0, InResolution);
+		});
+		return;
+	}
+	
+	TArray<float> Predicted;
+	Predicted.SetNumUninitialized(InResolution * InResolution);
+	ParallelFor(InResolution, [&](int32 Y)
+	{
+		AdvectRow(Source.GetData(), Predicted.GetData(), InVelocityX.GetData(), InVelocityY.GetData(), InResolution, DeltaTime, Y, 0, InResolution);
+	});
+	ParallelFor(InResolution, [&](int32 Y)
+	{
+		MacCormackRow(Source.GetData(), Predicted.GetData(), Output.GetData(), InVelocityX.GetData(), InVelocityY.GetData(), InResolution, DeltaTime, Y, 0, InResolution);
+	});
+}
+
+void FFluidSimulationCPU::MaintainDensity(const FFluidSimulationParams& SimParams)
+{
+	const float InvResolution = 1.0f / static_cast<float>(Resolution);
+	const float Target = FMath::Max(SimParams.BaseDensityTarget, 0.0f);
+	const float RecoverySpeed = FMath::Max(SimParams.BaseDensityRecoverySpeed, 0.0f);
+	const float NoiseRepeat = FMath::Max(SimParams.BaseDensityNoiseRepeat, 0.1f);
+	const float RecoveryAlpha = 1.0f - FMath::Exp(-RecoverySpeed * SimParams.DeltaTime);
+	const bool bInitialize = !bBaseDensityInitialized;
+	
+	// FluidDensityMaintenance.usf
+	ParallelFor(Resolution, [&](int32 Y)
+	{
+		const float V = 1.0f - (static_cast<float>(Y) + 0.5f) * InvResolution;
+		
+		for (int32 X = 0; X < Resolution; ++X)
+		{
+			const float U = (static_cast<float>(X) + 0.5f) * InvResolution;
+			
+			const float Noise = FMath::Clamp(FluidSimulationCPU::SampleBilinearMirror(
+				BaseDensityNoise.GetData(), BaseDensityNoiseWidth, BaseDensityNoiseHeight,
+				NoiseRepeat * U, NoiseRepeat * V), 0.0f, 1.0f);
+			const float TargetDensity = Target * Noise;
+			
+			float& Current = Density[Y * Resolution + X];
+			if (bInitialize)
+			{
+				Current = TargetDensity;
+			}
+			else if (Current < TargetDensity)
+			{
+				// 밀도 복구
+				Current = FMath::Lerp(Current, TargetDensity, RecoveryAlpha);
+			}
+		}
+	});
+	
+	bBaseDensityInitialized = true;
+}
+
+// ======== Interaction Force Bins ========
+void FFluidInteractionForceBins::Build(TConstArrayView<FFluidInteractionForceSource> Sources, int32 Resolution)
+{
+	SCOPE_CYCLE_COUNTER(STAT_VFF_InteractionForceBinning);
+	
+	constexpr int32 TileSize = FluidActiveTiles::TileSize;
+	
+	Resolution = FMath::Max(Resolution, 1);
+	NumTiles = FMath::DivideAndRoundUp(Resolution, TileSize);
+	const int32 NumTileCells = NumTiles * NumTiles;
+	const float InvResolution = 1.0f / static_cast<float>(Resolution);
+	const float TilesPerUV = static_cast<float>(Resolution) / static_cast<float>(TileSize);
+	const float CutoffRadius = FMath::Sqrt(FluidInteractionForceBins::CutoffSquared);
+	
+	// Source마다 걸칠 수 있는 tile 범위 (선분의 bounding box를 cutoff 반경만큼 넓힘, Max는 exclusive)
+	TArray<FIntRect> SourceTileRects;
+	SourceTileRects.SetNumUninitialized(Sources.Num());
+	TArray<TArray<int32>> RowSources;
+	RowSources.SetNum(NumTiles);
+	
+	auto ToTile = [TilesPerUV, this](float UV)
+	{
+		return FMath::FloorToInt32(FMath::Clamp(UV * TilesPerUV, -1.0f, static_cast<float>(NumTiles)));
+	};
+	
+	for (int32 SourceIndex = 0; SourceIndex < Sources.Num(); ++SourceIndex)
+	{
+		const FFluidInteractionForceSource& Source = Sources[SourceIndex];
+		const FVector2f Position(Source.PositionRadius.X, Source.PositionRadius.Y);
+		const FVector2f SweepStart = Position + FVector2f(Source.SweepOffset.X, Source.SweepOffset.Y);
+		const FVector2f Extent = FVector2f(FMath::Max(Source.PositionRadius.Z, 1e-4f), FMath::Max(Source.PositionRadius.W, 1e-4f)) * CutoffRadius;
+		
+		FIntRect& Rect = SourceTileRects[SourceIndex];
+		Rect.Min = FIntPoint(
+			FMath::Max(ToTile(FMath::Min(Position.X, SweepStart.X) - Extent.X), 0),
+			FMath::Max(ToTile(FMath::Min(Position.Y, SweepStart.Y) - Extent.Y), 0));
+		Rect.Max = FIntPoint(
+			FMath::Min(ToTile(FMath::Max(Position.X, SweepStart.X) + Extent.X) + 1, NumTiles),
+			FMath::Min(ToTile(FMath::Max(Position.Y, SweepStart.Y) + Extent.Y) + 1, NumTiles));
+		
+		for (int32 TileY = Rect.Min.Y; TileY < Rect.Max.Y; ++TileY)
+		{
+			RowSources[TileY].Add(SourceIndex);
+		}
+	}
+	
+	// Count: 영향 범위는 볼록하므로 tile row와 겹치는 tile은 연속 구간, 양 끝만 찾음 (X = source, Y/Z = [TileX 시작, 끝))
+	TArray<TArray<FIntVector>> RowSpans;
+	RowSpans.SetNum(NumTiles);
+	TArray<int32> TileCursors;
+	TileCursors.SetNumZeroed(NumTileCells);
+	
+	ParallelFor(NumTiles, [&](int32 TileY)
+	{
+		const float TileMinV = TileY * TileSize * InvResolution;
+		const float TileMaxV = FMath::Min((TileY + 1) * TileSize * InvResolution, 1.0f);
+		
+		auto Overlaps = [&](const FFluidInteractionForceSource& Source, int32 TileX)
+		{
+			const float TileMinU = TileX * TileSize * InvResolution;
+			const float TileMaxU = FMath::Min((TileX + 1) * TileSize * InvResolution, 1.0f);
+			return FluidSimulationCPU::ForceSourceOverlapsRect(Source, FVector2f(TileMinU, TileMinV), FVector2f(TileMaxU, TileMaxV));
+		};
+		
+		int32* RowCounts = TileCursors.GetData() + TileY * NumTiles;
+		for (const int32 SourceIndex : RowSources[TileY])
+		{
+			const FFluidInteractionForceSource& Source = Sources[SourceIndex];
+			const FIntRect& Rect = SourceTileRects[SourceIndex];
+			
+			int32 Begin = Rect.Min.X;
+			while (Begin < Rect.Max.X && !Overlaps(Source, Begin))
+			{
+				++Begin;
+			}
+			
+			int32 End = Rect.Max.X;
+			while (End > Begin && !Overlaps(Source, End - 1))
+			{
+				--End;
+			}
+			
+			if (Begin < End)
+			{
+				RowSpans[TileY].Emplace(SourceIndex, Begin, End);
+				for (int32 TileX = Begin; TileX < End; ++TileX)
+				{
+					++RowCounts[TileX];
+				}
+			}
+		}
+	});
+	
+	// Prefix sum (TileCursors는 scatter 위치로 재사용)
+	TileSourceOffsets.SetNumUninitialized(NumTileCells + 1);
+	int64 NumOverlaps = 0;
+	for (int32 TileIndex = 0; TileIndex < NumTileCells; ++TileIndex)
+	{
+		const int32 Count = TileCursors[TileIndex];
+		TileSourceOffsets[TileIndex] = static_cast<uint32>(NumOverlaps);
+		TileCursors[TileIndex] = static_cast<int32>(NumOverlaps);
+		NumOverlaps += Count;
+	}
+	
+	if (!ensureMsgf(NumOverlaps <= MAX_int32, TEXT("Interaction force bins overflow (%lld tile overlaps), forces are skipped"), NumOverlaps))
+	{
+		FMemory::Memzero(TileSourceOffsets.GetData(), TileSourceOffsets.Num() * sizeof(uint32));
+		SourceIndices.Reset();
+		return;
+	}
+	TileSourceOffsets[NumTileCells] = static_cast<uint32>(NumOverlaps);
+	
+	// Scatter: 한 tile은 한 row에서만 채우므로 tile 안 순서 = source 순서
+	SourceIndices.SetNumUninitialized(static_cast<int32>(NumOverlaps));
+	ParallelFor(NumTiles, [&](int32 TileY)
+	{
+		int32* RowCursors = TileCursors.GetData() + TileY * NumTiles;
+		for (const FIntVector& Span : RowSpans[TileY])
+		{
+			for (int32 TileX = Span.Y; TileX < Span.Z; ++TileX)
+			{
+				SourceIndices[RowCursors[TileX]++] = static_cast<uint32>(Span.X);
+			}
+		}
+	});
+}
+
+// ======== Density Snapshot ========
+void FFluidDensitySnapshot::Publish(TArray<float> InValues, int32 InResolution, const FVector& InBoundsOrigin,
+	const FVector& InBoundsExtent)
+{
+	check(InValues.Num() == InResolution * InResolution);
+	
+	FWriteScopeLock WriteLock(Lock);
+	Swap(Values, InValues);
+	Resolution = InResolution;
+	BoundsOrigin = InBoundsOrigin;
+	BoundsExtent = InBoundsExtent;
+}
+
+float FFluidDensitySnapshot::SampleAtWorldLocation(const FVector& WorldLocation) const
+{
+	FReadScopeLock ReadLock(Lock);
+	
+	if (Resolution <= 0 || BoundsExtent.X <= 0.0 || BoundsExtent.Y <= 0.0)
+	{
+		return 0.0f;
+	}
+	
+	const FVector Local = WorldLocation - BoundsOrigin;
+	if (FMath::Abs(Local.X) > BoundsExtent.X || FMath::Abs(Local.Y) > BoundsExtent.Y || FMath::Abs(Local.Z) > BoundsExtent.Z)
+	{
+		return 0.0f;
+	}
+	
+	// FFluidInteractionTracker::BuildSources의 World → UV
+	const float U = static_cast<float>((Local.X + BoundsExtent.X) / (BoundsExtent.X * 2.0));
+	const float V = 1.0f - static_cast<float>((Local.Y + BoundsExtent.Y) / (BoundsExtent.Y * 2.0));
+	
+	return FluidSimulationCPU::SampleBilinearClamp(Values.GetData(), Resolution, U, V);
+}
+
+bool FFluidDensitySnapshot::IsValid() const
+{
+	FReadScopeLock ReadLock(Lock);
+	return Resolution > 0;
+}
+
+// ======== CPU Simulation Worker ========
+FFluidSimulationCPUWorker::FFluidSimulationCPUWorker(TSharedRef<FFluidDensitySnapshot, ESPMode::ThreadSafe> InOutput)
+	: Output(MoveTemp(InOutput))
+{
+}
+
+void FFluidSimulationCPUWorker::Init(int32 InResolution, TArray<float> BaseDensityNoise, int32 NoiseWidth, int32 NoiseHeight)
+{
+	WaitForCompletion();
+	
+	Simulation.Init(InResolution);
+	Simulation.SetBaseDensityNoise(MoveTemp(BaseDensityNoise), NoiseWidth, NoiseHeight);
+}
+
+bool FFluidSimulationCPUWorker::IsStepInFlight() const
+{
+	return StepTask.IsValid() && !StepTask->IsComplete();
+}
+
+void FFluidSimulationCPUWorker::KickStep(FFluidSimulationParams SimParams, const FVector& BoundsOrigin,
+	const FVector& BoundsExtent, TSharedPtr<FFluidInteractionSourceSlot, ESPMode::ThreadSafe> InteractionSources)
+{
+	check(IsInGameThread());
+	check(!IsStepInFlight());
+	
+	// Source 계산 task가 끝난 뒤 시작
+	FGraphEventArray Prerequisites;
+	if (InteractionSources.IsValid() && InteractionSources->BuildTask.IsValid())
+	{
+		Prerequisites.Add(InteractionSources->BuildTask);
+	}
+	
+	// Task가 Self를 잡고 있으므로 Component가 먼저 사라져도 안전
+	StepTask = FFunctionGraphTask::CreateAndDispatchWhenReady(
+		[Self = AsShared(), SimParams = MoveTemp(SimParams), BoundsOrigin, BoundsExtent, InteractionSources]() mutable
+		{
+			if (InteractionSources.IsValid())
+			{
+				InteractionSources->TakeSources(SimParams.InteractionForceSources);
+			}
+			
+			Self->Simulation.Step(SimParams);
+			
+			// Slot 할당 재사용
+			if (InteractionSources.IsValid())
+			{
+				InteractionSources->ReturnSources(MoveTemp(SimParams.InteractionForceSources));
+			}
+			
+			TArray<float> Values(Self->Simulation.GetDensity());
+			Self->Output->Publish(MoveTemp(Values), Self->Simulation.GetResolution(), BoundsOrigin, BoundsExtent);
+		},
+		TStatId(),
+		Prerequisites.IsEmpty() ? nullptr : &Prerequisites,
+		ENamedThreads::AnyBackgroundThreadNormalTask);
+}
+
+void FFluidSimulationCPUWorker::WaitForCompletion()
+{
+	if (StepTask.IsValid())
+	{
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(StepTask);
+		StepTask.SafeRelease();
+	}
+}
@@ -2,12 +2,16 @@
 
 
 #include "FluidShaders.h"
+#include "FluidPressureSolverCPU.h"
+#include "FluidSimulationCPU.h"
+#include "FluidInteractionTracker.h"
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
 #include "RHICommandList.h"
 #include "RHIStaticStates.h"
 #include "GlobalShader.h"
 #include "VolumetricFluidFog.h"
+#include "FluidFogSubsystem.h"
 #include "Components/BoxComponent.h"
 #include "Curves/CurveFloat.h"
 #include "Stats/StatsHierarchical.h"
@@ -19,13 +23,202 @@
 #include "Components/PrimitiveComponent.h" 
 #include "DrawDebugHelpers.h"
 #include "SystemTextures.h"
+#include "Misc/App.h"
 
 DECLARE_GPU_STAT_NAMED(VFF_FluidSimulation, TEXT("VFF_FluidSimulation"));
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pressure Iterations"), STAT_VFF_PressureIterations, STATGROUP_VolumetricFog);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Pressure Relative Residual"), STAT_VFF_PressureResidual, STATGROUP_VolumetricFog);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Simulation Substeps"), STAT_VFF_SimulationSubsteps, STATGROUP_VolumetricFog);
+
+namespace FluidSimulationComponent
+{
+	/** CPU 시뮬레이션이 밀렸을 때 한 스텝에 몰아서 적용할 최대 시간 */
+	constexpr float MaxCPUSimulationDeltaTime = 0.1f;
+	
+	/** GPU 시간이 아직 측정되지 않은 Simulation의 100만 셀당 step 비용 추정 (ms) */
+	constexpr float DefaultGPUMillisecondsPerMegaCell = 1.0f;
+	
+	/**
+	 * 누적 시간에서 고정 step을 꺼냄 (반환 = 이번 프레임 step 수)
+	 * MaxSubsteps를 넘는 시간은 한 step 미만만 남기고 버림 (hitch 후 다음 프레임들에 step이 몰리지 않도록)
+	 * 남는 시간이 한 step과 같으면 InterpolationAlpha가 1이 되므로 한 step보다 조금 짧게 자름
+	 */
+	int32 ConsumeFixedSubsteps(float& InOutAccumulatedTime, float DeltaTime, float FixedDeltaTime, int32 MaxSubsteps)
+	{
+		InOutAccumulatedTime += FMath::Max(DeltaTime, 0.0f);
+		
+		const int32 NumSubsteps = FMath::Min(FMath::FloorToInt(InOutAccumulatedTime / FixedDeltaTime), MaxSubsteps);
+		InOutAccumulatedTime -= static_cast<float>(NumSubsteps) * FixedDeltaTime;
+		if (NumSubsteps == MaxSubsteps)
+		{
+			InOutAccumulatedTime = FMath::Min(InOutAccumulatedTime, FixedDeltaTime * (1.0f - KINDA_SMALL_NUMBER));
+		}
+		return NumSubsteps;
+	}
+	
+	/** 압축되지 않은 포맷(B8G8R8A8, G8)의 Mip 0 R 채널을 0~1 float로 읽기 */
+	bool ReadTextureRedChannel(const UTexture2D* Texture, TArray<float>& OutValues, int32& OutWidth, int32& OutHeight)
+	{
+		const FTexturePlatformData* PlatformData = Texture ? Texture->GetPlatformData() : nullptr;
+		if (!PlatformData || PlatformData->Mips.IsEmpty())
+		{
+			return false;
+		}
+		
+		const EPixelFormat Format = PlatformData->PixelFormat;
+		if (Format != PF_B8G8R8A8 && Format != PF_G8)
+		{
+			return false;
+		}
+		
+		const FTexture2DMipMap& Mip = PlatformData->Mips[0];
+		const uint8* Data = static_cast<const uint8*>(Mip.BulkData.LockReadOnly());
+		if (!Data)
+		{
+			Mip.BulkData.Unlock();
+			return false;
+		}
+		
+		const int32 Stride = Format == PF_B8G8R8A8 ? 4 : 1;
+		const int32 RedOffset = Format == PF_B8G8R8A8 ? 2 : 0;
+		
+		OutWidth = Mip.SizeX;
+		OutHeight = Mip.SizeY;
+		OutValues.SetNumUninitialized(OutWidth * OutHeight);
+		for (int32 Index = 0; Index < OutValues.Num(); ++Index)
+		{
+			OutValues[Index] = static_cast<float>(Data[Index * Stride + RedOffset]) / 255.0f;
+		}
+		
+		Mip.BulkData.Unlock();
+		return true;
+	}
+	
+	/** Per-cell pass의 dispatch 방식 (ActiveTileList가 없으면 전체 grid) */
+	struct FTileDispatch
+	{
+		FRDGBufferSRVRef ActiveTileList = nullptr;
+		FRDGBufferRef ActiveTileArgs = nullptr;
+		FIntVector GroupCount = FIntVector(1, 1, 1);
+	};
+	
+	/** FFluidActiveTilesDim permutation을 골라 dense / indirect(active tile) dispatch */
+	template<typename ShaderType>
+	void AddTiledPass(FRDGBuilder& GraphBuilder, FRDGEventName&& PassName, const FTileDispatch& Dispatch,
+		typename ShaderType::FParameters* Params)
+	{
+		const bool bActiveTiles = Dispatch.ActiveTileList != nullptr;
+		
+		typename ShaderType::FPermutationDomain PermutationVector;
+		PermutationVector.template Set<FFluidActiveTilesDim>(bActiveTiles);
+		
+		TShaderMapRef<ShaderType> Shader(
+			GetGlobalShaderMap(GMaxRHIFeatureLevel), PermutationVector);
+		
+		if (bActiveTiles)
+		{
+			Params->Tiles.ActiveTileList = Dispatch.ActiveTileList;
+			Params->Tiles.ActiveTileIndirectArgs = Dispatch.ActiveTileArgs;
+			
+			FComputeShaderUtils::AddPass(
+				GraphBuilder,
+				MoveTemp(PassName),
+				Shader,
+				Params,
+				Dispatch.ActiveTileArgs,
+				0);
+		}
+		else
+		{
+			FComputeShaderUtils::AddPass(
+				GraphBuilder,
+				MoveTemp(PassName),
+				Shader,
+				Params,
+				Dispatch.GroupCount);
+		}
+	}
+	
+	/** FFluidInteractionForceBins를 올린 buffer (Force / TileClassify pass 입력) */
+	struct FInteractionForceBinBuffers
+	{
+		FRDGBufferSRVRef Sources = nullptr;
+		FRDGBufferSRVRef TileSourceOffsets = nullptr;
+		FRDGBufferSRVRef TileSourceIndices = nullptr;
+		int32 NumTiles = 0;
+	};
+	
+	/** Source 목록과 tile binning 결과를 StructuredBuffer로 올림 (source 수 제한 없음, 크기는 source footprint의 합에 비례) */
+	FInteractionForceBinBuffers CreateInteractionForceBinBuffers(FRDGBuilder& GraphBuilder, const FFluidSimulationParams& SimParams, int32 Resolution)
+	{
+		const TArray<FFluidInteractionForceSource>& Sources = SimParams.InteractionForceSources;
+		
+		FFluidInteractionForceBins Bins;
+		Bins.Build(Sources, Resolution);
+		
+		// Source / index가 없어도 SRV는 필요 (빈 buffer는 만들 수 없음)
+		const FFluidInteractionForceSource DummySource;
+		const uint32 DummyIndex = 0;
+		const int32 SourceCount = Sources.Num();
+		const int32 IndexCount = Bins.SourceIndices.Num();
+		
+		FRDGBufferRef SourceBuffer = CreateStructuredBuffer(
+			GraphBuilder,
+			TEXT("FluidInteractionForceSources"),
+			sizeof(FFluidInteractionForceSource),
+			FMath::Max(SourceCount, 1),
+			SourceCount > 0 ? Sources.GetData() : &DummySource,
+			sizeof(FFluidInteractionForceSource) * FMath::Max(SourceCount, 1));
+		
+		FRDGBufferRef TileSourceOffsets = CreateStructuredBuffer(
+			GraphBuilder,
+			TEXT("FluidForceTileSourceOffsets"),
+			sizeof(uint32),
+			Bins.TileSourceOffsets.Num(),
+			Bins.TileSourceOffsets.GetData(),
+			sizeof(uint32) * Bins.TileSourceOffsets.Num());
+		
+		FRDGBufferRef TileSourceIndices = CreateStructuredBuffer(
+			GraphBuilder,
+			TEXT("FluidForceTileSourceIndices"),
+			sizeof(uint32),
+			FMath::Max(IndexCount, 1),
+			IndexCount > 0 ? Bins.SourceIndices.GetData() : &DummyIndex,
+			sizeof(uint32) * FMath::Max(IndexCount, 1));
+		
+		FInteractionForceBinBuffers Buffers;
+		Buffers.Sources = GraphBuilder.CreateSRV(SourceBuffer);
+		Buffers.TileSourceOffsets = GraphBuilder.CreateSRV(TileSourceOffsets);
+		Buffers.TileSourceIndices = GraphBuilder.CreateSRV(TileSourceIndices);
+		Buffers.NumTiles = Bins.NumTiles;
+		return Buffers;
+	}
+}
 	
 // ======== Fluid Resource ========
-void FFluidResources::Init(int32 Res, FRHICommandListImmediate& RHICmdList)
+int32 FFluidSimulationPrecision::GetBytesPerCell(bool bInPlacePressure) const
+{
+	auto BytesPerChannel = [](EFluidTexturePrecision InPrecision)
+	{
+		return InPrecision == EFluidTexturePrecision::Half ? 2 : 4;
+	};
+	
+	// Velocity A/B + TempVelocity (RG), Density A/B, Pressure A/(B) + Divergence
+	return 3 * 2 * BytesPerChannel(Velocity)
+		+ 2 * BytesPerChannel(Density)
+		+ (bInPlacePressure ? 2 : 3) * BytesPerChannel(Pressure);
+}
+
+void FFluidResources::Init(int32 Res, bool bInInPlacePressure, const FFluidSimulationPrecision& InPrecision, FRHICommandListImmediate& RHICmdList)
 {
 	Resolution = Res;
+	bInPlacePressure = bInInPlacePressure;
+	Precision = InPrecision;
+	
+	const EPixelFormat VelocityFormat = Precision.Velocity == EFluidTexturePrecision::Half ? PF_G16R16F : PF_G32R32F;
+	const EPixelFormat DensityFormat = Precision.Density == EFluidTexturePrecision::Half ? PF_R16F : PF_R32_FLOAT;
+	const EPixelFormat PressureFormat = Precision.Pressure == EFluidTexturePrecision::Half ? PF_R16F : PF_R32_FLOAT;
 
 	auto CreateUAVTexForCS = [&](const TCHAR* Name, EPixelFormat Format) -> FTextureRHIRef
 	{
@@ -39,19 +232,25 @@ void FFluidResources::Init(int32 Res, FRHICommandListImmediate& RHICmdList)
 		return RHICreateTexture(Desc);
 	};
 	
-	Velocity[0] = CreateUAVTexForCS(TEXT("FluidVelocityA"), PF_G32R32F);
-	Velocity[1] = CreateUAVTexForCS(TEXT("FluidVelocityB"), PF_G32R32F);
+	Velocity[0] = CreateUAVTexForCS(TEXT("FluidVelocityA"), VelocityFormat);
+	Velocity[1] = CreateUAVTexForCS(TEXT("FluidVelocityB"), VelocityFormat);
 
-	Density[0] = CreateUAVTexForCS(TEXT("FluidDensityA"), PF_R32_FLOAT);
-	Density[1] = CreateUAVTexForCS(TEXT("FluidDensityB"), PF_R32_FLOAT);
+	Density[0] = CreateUAVTexForCS(TEXT("FluidDensityA"), DensityFormat);
+	Density[1] = CreateUAVTexForCS(TEXT("FluidDensityB"), DensityFormat);
 	
-	Pressure[0] = CreateUAVTexForCS(TEXT("FluidPressureA"), PF_R32_FLOAT);
-	Pressure[1] = CreateUAVTexForCS(TEXT("FluidPressureB"), PF_R32_FLOAT);
-
-	Divergence = CreateUAVTexForCS(TEXT("FluidDivergence"), PF_R32_FLOAT);
-	Vorticity = CreateUAVTexForCS(TEXT("FluidVorticity"), PF_R32_FLOAT);
+	Pressure[0] = CreateUAVTexForCS(TEXT("FluidPressureA"), PressureFormat);
+	if (!bInPlacePressure)
+	{
+		Pressure[1] = CreateUAVTexForCS(TEXT("FluidPressureB"), PressureFormat);
+	}
 
-	TempVelocity = CreateUAVTexForCS(TEXT("FluidTempVelocity"), PF_G32R32F);
+	const int32 NumTiles = FMath::DivideAndRoundUp(Res, FluidActiveTiles::TileSize);
+	TileMask = RHICreateTexture(FRHITextureCreateDesc::Create2D(TEXT("FluidTileMask"))
+		.SetExtent(NumTiles, NumTiles)
+		.SetFormat(PF_R32_UINT)
+		.SetNumMips(1)
+		.SetFlags(ETextureCreateFlags::ShaderResource | ETextureCreateFlags::UAV)
+		.SetInitialState(ERHIAccess::UAVCompute));
 	
 	
 	/** Create Texture Using Pooled Render Target */
@@ -62,14 +261,210 @@ void FFluidResources::Init(int32 Res, FRHICommandListImmediate& RHICmdList)
 	DensityPooledRT[1] = CreateRenderTarget(Density[1], TEXT("FluidDensityB"));
 
 	PressurePooledRT[0] = CreateRenderTarget(Pressure[0], TEXT("FluidPressureA"));
-	PressurePooledRT[1] = CreateRenderTarget(Pressure[1], TEXT("FluidPressureB"));
+	if (Pressure[1])
+	{
+		PressurePooledRT[1] = CreateRenderTarget(Pressure[1], TEXT("FluidPressureB"));
+	}
 
-	DivergencePooledRT = CreateRenderTarget(Divergence, TEXT("FluidDivergence"));
-	VorticityPooledRT = CreateRenderTarget(Vorticity, TEXT("FluidVorticity"));
-	TempVelocityPooledRT = CreateRenderTarget(TempVelocity, TEXT("FluidTempVelocity"));
+	// Divergence / TempVelocity는 AddSimulationPasses에서 (Dense: transient, Active tile: 처음 쓸 때 생성)
+	DivergencePooledRT.SafeRelease();
+	TempVelocityPooledRT.SafeRelease();
+	TileMaskPooledRT = CreateRenderTarget(TileMask, TEXT("FluidTileMask"));
+	
+	UE_LOG(LogTemp, Log, TEXT("FluidResources: %dx%d, %.1f MB"), Res, Res,
+		static_cast<double>(Precision.GetBytesPerCell(bInPlacePressure)) * Res * Res / (1024.0 * 1024.0));
 	  
 	bInitialize = true;
 	bBaseDensityInitialized = false;
+	bPressureHistoryValid = false;
+	bTileMaskValid = false;
+	
+	for (TUniquePtr<FRHIGPUBufferReadback>& Readback : PressureResidualReadbacks)
+	{
+		Readback = MakeUnique<FRHIGPUBufferReadback>(TEXT("FluidPressureResidualReadback"));
+	}
+	PressureResidualWriteIndex = 0;
+	PressureResidualPendingCount = 0;
+	AdaptivePressureIterations = 0;
+	
+	for (TUniquePtr<FRHIGPUTextureReadback>& Readback : DensityReadbacks)
+	{
+		Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("FluidDensityReadback"));
+	}
+	DensityReadbackWriteIndex = 0;
+	DensityReadbackPendingCount = 0;
+}
+
+bool FFluidResources::PollPressureResidual(float& OutRelativeResidual)
+{
+	bool bFound = false;
+	
+	// 오래된 것부터 확인, 준비된 것은 모두 소비하고 가장 최근 값을 사용
+	while (PressureResidualPendingCount > 0)
+	{
+		const int32 ReadIndex = (PressureResidualWriteIndex - PressureResidualPendingCount + NumPressureResidualReadbacks) % NumPressureResidualReadbacks;
+		FRHIGPUBufferReadback* Readback = PressureResidualReadbacks[ReadIndex].Get();
+		
+		if (!Readback->IsReady())
+		{
+			break;
+		}
+		
+		const uint32* MaxValues = static_cast<const uint32*>(Readback->Lock(2 * sizeof(uint32)));
+		const float MaxResidual = FMath::Abs(*reinterpret_cast<const float*>(&MaxValues[0]));
+		const float MaxRhs = FMath::Abs(*reinterpret_cast<const float*>(&MaxValues[1]));
+		Readback->Unlock();
+		
+		OutRelativeResidual = MaxResidual / FMath::Max(MaxRhs, UE_SMALL_NUMBER);
+		bFound = true;
+		--PressureResidualPendingCount;
+	}
+	
+	return bFound;
+}
+
+void FFluidResources::PollDensityReadback()
+{
+	while (DensityReadbackPendingCount > 0)
+	{
+		const int32 ReadIndex = (DensityReadbackWriteIndex - DensityReadbackPendingCount + NumDensityReadbacks) % NumDensityReadbacks;
+		FRHIGPUTextureReadback* Readback = DensityReadbacks[ReadIndex].Get();
+		
+		if (!Readback->IsReady())
+		{
+			break;
+		}
+		
+		const FDensityReadbackRequest& Request = DensityReadbackRequests[ReadIndex];
+		
+		int32 RowPitchInPixels = 0;
+		const float* Data = static_cast<const float*>(Readback->Lock(RowPitchInPixels));
+		if (Data && DensitySnapshot.IsValid())
+		{
+			TArray<float> Values;
+			Values.SetNumUninitialized(Request.Resolution * Request.Resolution);
+			for (int32 Y = 0; Y < Request.Resolution; ++Y)
+			{
+				FMemory::Memcpy(&Values[Y * Request.Resolution], Data + Y * RowPitchInPixels, Request.Resolution * sizeof(float));
+			}
+			
+			DensitySnapshot->Publish(MoveTemp(Values), Request.Resolution, Request.BoundsOrigin, Request.BoundsExtent);
+		}
+		Readback->Unlock();
+		
+		--DensityReadbackPendingCount;
+	}
+}
+
+void FFluidResources::Resize(int32 NewRes, FRHICommandListImmediate& RHICmdList)
+{
+	if (!bInitialize || NewRes == Resolution)
+	{
+		return;
+	}
+	
+	const int32 OldRes = Resolution;
+	const TRefCountPtr<IPooledRenderTarget> OldVelocity = VelocityPooledRT[VelocityIndex];
+	const TRefCountPtr<IPooledRenderTarget> OldDensity = DensityPooledRT[DensityIndex];
+	const bool bWasBaseDensityInitialized = bBaseDensityInitialized;
+	
+	Init(NewRes, bInPlacePressure, Precision, RHICmdList);
+	VelocityIndex = 0;
+	DensityIndex = 0;
+	PressureIndex = 0;
+	
+	// 재샘플한 Density가 있으므로 Base Density로 다시 채우지 않음
+	bBaseDensityInitialized = bWasBaseDensityInitialized;
+	
+	FRDGBuilder GraphBuilder(RHICmdList);
+	TShaderMapRef<FFluidResampleCS> Shader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	
+	auto AddResamplePass = [&](const TRefCountPtr<IPooledRenderTarget>& Input, const TRefCountPtr<IPooledRenderTarget>& Output, float ValueScale)
+	{
+		auto* Params = GraphBuilder.AllocParameters<FFluidResampleCS::FParameters>();
+		Params->ResampleInput = GraphBuilder.RegisterExternalTexture(Input);
+		Params->ResampleOutput = GraphBuilder.CreateUAV(GraphBuilder.RegisterExternalTexture(Output, ERDGTextureFlags::MultiFrame));
+		Params->BilinearSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp>::GetRHI();
+		Params->OutputResolution = FIntPoint(NewRes, NewRes);
+		Params->ValueScale = FVector4f(ValueScale, ValueScale, ValueScale, ValueScale);
+		
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("VFF_Fluid.Resample %d -> %d", OldRes, NewRes),
+			Shader,
+			Params,
+			FComputeShaderUtils::GetGroupCount(FIntPoint(NewRes, NewRes), 8));
+	};
+	
+	// Velocity는 셀/초 단위
+	AddResamplePass(OldVelocity, VelocityPooledRT[0], static_cast<float>(NewRes) / static_cast<float>(OldRes));
+	AddResamplePass(OldDensity, DensityPooledRT[0], 1.0f);
+	
+	GraphBuilder.Execute();
+}
+
+void FFluidResources::BeginGPUTimer(FRHICommandListImmediate& RHICmdList)
+{
+	// 이전 결과가 아직 안 돌아왔으면 이번 step은 측정하지 않음
+	bGPUTimerActive = GSupportsTimestampRenderQueries && GPUTimerPendingCount < NumGPUTimers;
+	if (!bGPUTimerActive)
+	{
+		return;
+	}
+	
+	const int32 WriteIndex = GPUTimerWriteIndex;
+	if (!GPUTimerBegin[WriteIndex].IsValid())
+	{
+		GPUTimerBegin[WriteIndex] = RHICreateRenderQuery(RQT_AbsoluteTime);
+		GPUTimerEnd[WriteIndex] = RHICreateRenderQuery(RQT_AbsoluteTime);
+	}
+	RHICmdList.EndRenderQuery(GPUTimerBegin[WriteIndex]);
+}
+
+void FFluidResources::EndGPUTimer(FRHICommandListImmediate& RHICmdList, int32 NumSubsteps)
+{
+	if (!bGPUTimerActive)
+	{
+		return;
+	}
+	
+	const int32 WriteIndex = GPUTimerWriteIndex;
+	RHICmdList.EndRenderQuery(GPUTimerEnd[WriteIndex]);
+	GPUTimerResolutions[WriteIndex] = Resolution;
+	GPUTimerSubsteps[WriteIndex] = FMath::Max(NumSubsteps, 1);
+	
+	GPUTimerWriteIndex = (WriteIndex + 1) % NumGPUTimers;
+	++GPUTimerPendingCount;
+	bGPUTimerActive = false;
+}
+
+void FFluidResources::PollGPUTimer()
+{
+	while (GPUTimerPendingCount > 0)
+	{
+		const int32 ReadIndex = (GPUTimerWriteIndex - GPUTimerPendingCount + NumGPUTimers) % NumGPUTimers;
+		
+		uint64 BeginMicroseconds = 0;
+		uint64 EndMicroseconds = 0;
+		if (!RHIGetRenderQueryResult(GPUTimerBegin[ReadIndex], BeginMicroseconds, false)
+			|| !RHIGetRenderQueryResult(GPUTimerEnd[ReadIndex], EndMicroseconds, false))
+		{
+			break;
+		}
+		--GPUTimerPendingCount;
+		
+		if (EndMicroseconds <= BeginMicroseconds)
+		{
+			continue;
+		}
+		
+		// 한 구간의 substep들을 step 하나의 셀당 시간으로
+		const double MegaCells = FMath::Square(static_cast<double>(GPUTimerResolutions[ReadIndex])) / 1.0e6
+			* static_cast<double>(GPUTimerSubsteps[ReadIndex]);
+		const float Sample = static_cast<float>(static_cast<double>(EndMicroseconds - BeginMicroseconds) / 1000.0 / MegaCells);
+		const float Previous = GPUMillisecondsPerMegaCell.load(std::memory_order_relaxed);
+		GPUMillisecondsPerMegaCell.store(Previous > 0.0f ? FMath::Lerp(Previous, Sample, 0.2f) : Sample, std::memory_order_relaxed);
+	}
 }
 
 // ======== Fluid Simulation Component ========
@@ -83,19 +478,31 @@ void UFluidSimulationComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// PIE에 들어갈 때, 한 번 GPU에 올리기
-	FluidResources = MakeShared<FFluidResources, ESPMode::ThreadSafe>();
-	int32 Res = SimResolution;
-	auto Resources = FluidResources;
-	
-	// Render thread에서 resources 초기화
-	ENQUEUE_RENDER_COMMAND(FInitFluidResource)
-	(
-		[Resources, Res](FRHICommandListImmediate& RHICmdList)
-		{
-			Resources->Init(Res, RHICmdList);
-		}
-	);
+	if (ShouldUseCPUSimulation())
+	{
+		InitCPUSimulation();
+	}
+	else
+	{
+		// PIE에 들어갈 때, 한 번 GPU에 올리기
+		FluidResources = MakeShared<FFluidResources, ESPMode::ThreadSafe>();
+		DensitySnapshot = MakeShared<FFluidDensitySnapshot, ESPMode::ThreadSafe>();
+		FluidResources->DensitySnapshot = DensitySnapshot;
+		ActiveSimResolution = SimResolution;
+		int32 Res = SimResolution;
+		const bool bInPlacePressure = PressureSolverMode == EFluidPressureSolverMode::RedBlackSOR;
+		const FFluidSimulationPrecision Precision = GetSimulationPrecision();
+		auto Resources = FluidResources;
+		
+		// Render thread에서 resources 초기화
+		ENQUEUE_RENDER_COMMAND(FInitFluidResource)
+		(
+			[Resources, Res, bInPlacePressure, Precision](FRHICommandListImmediate& RHICmdList)
+			{
+				Resources->Init(Res, bInPlacePressure, Precision, RHICmdList);
+			}
+		);
+	}
 	
 	// Curve Data 
 	const bool bUseCurveAttenuation = HeightAttenuationMode == EFluidHeightAttenuationMode::CurveAttenuation;
@@ -107,30 +514,36 @@ void UFluidSimulationComponent::BeginPlay()
 	
 		
 	// Fog Data Snapshot을 Render Thread에 전달 
-	FogExtension = FSceneViewExtensions::NewExtension<FFogSceneViewExtension>();
+	FogRenderProxy = MakeShared<FFogVolumeRenderProxy, ESPMode::ThreadSafe>();
 	
-	if (FogExtension.IsValid())
 	{
 		const FFluidFogRenderState InitialState = BuildFogRenderStateSnapShot();
-		auto Ext = FogExtension;
+		auto Proxy = FogRenderProxy;
 		
-		ENQUEUE_RENDER_COMMAND(InitFogExtension) 
-		([Ext, InitialState](FRHICommandListImmediate& RHUCmdList)
+		ENQUEUE_RENDER_COMMAND(InitFogRenderProxy) 
+		([Proxy, InitialState](FRHICommandListImmediate& RHUCmdList)
 		{
-			if (Ext.IsValid())
-			{
-				Ext->ApplyRenderState_RenderThread(InitialState);
-			}
+			Proxy->ApplyRenderState_RenderThread(InitialState);
 		});
 	} 
 	
+	// World의 Fog Volume들은 Subsystem의 공유 Extension이 한 번에 렌더
+	if (UFluidFogSubsystem* FogSubsystem = GetWorld()->GetSubsystem<UFluidFogSubsystem>())
+	{
+		FogSubsystem->RegisterFogVolume(this, FogRenderProxy);
+		
+		// Simulation step은 Subsystem이 LOD / GPU 예산에 맞춰 호출
+		SetComponentTickEnabled(false);
+	}
+	
 	if (bUseCurveAttenuation)
 	{
-		PushHeightCurveSamplesToFogExtension();
+		PushHeightCurveSamplesToFogProxy();
 		bHeightCurveDirty = false;
 	}
 	
 	// Interaction을 위한 overlap binding 
+	InteractionTracker = MakeShared<FFluidInteractionTracker>();
 	if (AVolumetricFluidFog* FogActor = Cast<AVolumetricFluidFog>(GetOwner()))
 	{
 		if (UBoxComponent* Box = FogActor->GetBoundsComponents())
@@ -164,96 +577,146 @@ void UFluidSimulationComponent::TickComponent(float DeltaTime, enum ELevelTick T
 	FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	 
-	if (DirectionalLightActor)
-	{	
-		//FRotator LightRotation = DirectionalLightActor->GetActorRotation();
-		//LightRotation.Yaw += DeltaTime * 20.0f;
-		////LightRotation.Yaw = FMath::UnwindDegrees(LightRotation.Yaw);
-		//DirectionalLightActor->SetActorRotation(LightRotation); 
+	
+	StepSimulation(DeltaTime);
+}
+
+void UFluidSimulationComponent::StepSimulation(float DeltaTime, float MinStepInterval)
+{
+	// CPU 시뮬레이션은 Render thread를 거치지 않음 (밀린 시간을 한 step으로)
+	if (CPUSimulation)
+	{
+		TickCPUSimulation(DeltaTime);
+		return;
 	}
+	
 	// Resources가 초기화되지 않았으면 Early Return
-		if (!FluidResources)
+	if (!FluidResources || !FogRenderProxy)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("TickComponent: Fluid Resources is Null"));
+		UE_LOG(LogTemp, Verbose, TEXT("StepSimulation: Fluid Resources is Null"));
 		return;
 	}
 	
-	// 게임스레드에서 설정해둔 Fog관련 값들 캡처
-	auto Resources = FluidResources;
-	float DT = DeltaTime;
-	float Diss = Dissipation;
-	float Vortiy = VorticityStrengthParam;
-	float Visc = Viscosity;
-	int32 PresItr = PressureIterations; 
- 
-	const bool bDensityMaintenance = bEnableDensityMaintenance;
-	const float DensityTarget = BaseDensityTarget;
-	const float DensityRecoverySpeed = BaseDensityRecoverySpeed;
-	const float DensityDeadbandRatio = BaseDensityDeadbandRatio;
-	const float DensityNoiseRepeat = BaseDensityNoiseRepeat;
-	 
-	FTextureRHIRef BaseDensityNoiseTexRHI = nullptr;
-	if (BaseDensityNoiseTexture && BaseDensityNoiseTexture->GetResource())
+	// 프레임 시간을 누적해 고정 step으로 (Variable은 DeltaTime으로 한 step)
+	int32 NumSubsteps = 1;
+	float StepDeltaTime = DeltaTime;
+	float InterpolationAlpha = 1.0f;
+	if (TimestepMode == EFluidSimulationTimestepMode::Variable)
+	{
+		AccumulatedTime = 0.0f;
+	}
+	else
 	{
-		BaseDensityNoiseTexRHI = BaseDensityNoiseTexture->GetResource()->TextureRHI;
+		StepDeltaTime = GetFixedStepDeltaTime(MinStepInterval);
+		NumSubsteps = FluidSimulationComponent::ConsumeFixedSubsteps(AccumulatedTime, DeltaTime, StepDeltaTime, FMath::Clamp(MaxSubsteps, 1, 8));
+		
+		// 렌더링은 한 step 늦게: 이전 step → 마지막 step 사이를 남은 시간 비율로 보간
+		if (TimestepMode == EFluidSimulationTimestepMode::Interpolated)
+		{
+			InterpolationAlpha = FMath::Clamp(AccumulatedTime / StepDeltaTime, 0.0f, 1.0f);
+		}
 	}
+	INC_DWORD_STAT_BY(STAT_VFF_SimulationSubsteps, NumSubsteps);
+	
+	// 게임스레드에서 설정해둔 Fog관련 값들 캡처
+	auto Resources = FluidResources;
+	FFluidSimulationParams SimParams = BuildSimulationParamsSnapShot(StepDeltaTime);
+	SimParams.bDensityHistory = TimestepMode == EFluidSimulationTimestepMode::Interpolated;
 	
 	FFluidFogRenderState Snapshot  =  BuildFogRenderStateSnapShot();
-	auto Ext = FogExtension;
+	Snapshot.DensityInterpolationAlpha = InterpolationAlpha;
+	auto Proxy = FogRenderProxy;
 	
 	
-	//Interaction Param
-	TArray<FFluidInteractionForceSource> InteractionForceSources = BuildInteractionForceSources(DeltaTime);
+	// Interaction Source는 background task에서 계산, Render thread에서 완료를 기다림
+	// Step이 없는 프레임은 건너뛰고 다음 step에서 그동안의 이동을 한 번에 (모든 substep에 같은 Source)
+	InteractionElapsedTime += DeltaTime;
+	TSharedPtr<FFluidInteractionSourceSlot, ESPMode::ThreadSafe> InteractionSources;
+	if (NumSubsteps > 0)
+	{
+		InteractionSources = KickInteractionSourceBuild(InteractionElapsedTime);
+		InteractionElapsedTime = 0.0f;
+	}
 	
-	ENQUEUE_RENDER_COMMAND(FFluidSimluationStep)(
-	[ Resources, Ext, Snapshot, 
-		DT, Diss,  
-        bDensityMaintenance, BaseDensityNoiseTexRHI,DensityTarget,DensityRecoverySpeed, DensityDeadbandRatio, DensityNoiseRepeat,
-        InteractionForceSources,
-        Vortiy, Visc, PresItr](FRHICommandListImmediate& RHICmdList) mutable 
+	// Simulation pass는 Render thread에서 바로 실행하지 않고 Proxy에 대기시켰다가
+	// FFogSceneViewExtension::PreRenderViewFamily_RenderThread가 Fog 렌더와 같은 frame graph에 기록
+	FFogSimulationUpdate Update =
+	[ Resources, Snapshot, SimParams = MoveTemp(SimParams), InteractionSources = MoveTemp(InteractionSources), NumSubsteps](FRDGBuilder& GraphBuilder, FFogVolumeRenderProxy& Proxy) mutable 
 	{
 		if (!Resources->bInitialize)
 		{
-			if (Ext.IsValid())
-			{
-				FFluidFogRenderState DisabledState = Snapshot;
-				DisabledState.bEnable = false;
-				Ext->ApplyRenderState_RenderThread(DisabledState);
-			}
+			FFluidFogRenderState DisabledState = Snapshot;
+			DisabledState.bEnable = false;
+			Proxy.ApplyRenderState_RenderThread(DisabledState);
 			return;
 		}
 
-		int32 InVelIdx = Resources->VelocityIndex;
-		int32 InDenIdx = Resources->DensityIndex;
-		int32 InPressIdx = Resources->PressureIndex;
-		
-		int32 OutVelIdx = InVelIdx, OutDenIdx = InDenIdx, OutPrsIdx = InPressIdx;
-         
-		// 시뮬레이션
-		UFluidSimulationComponent::ExecuteSimulationRDG(RHICmdList, Resources,
-			DT,InVelIdx, InDenIdx, InPressIdx,
-					   Diss, 
-                       Vortiy, Visc, PresItr,
-                       bDensityMaintenance, BaseDensityNoiseTexRHI,DensityTarget,DensityRecoverySpeed, DensityDeadbandRatio, DensityNoiseRepeat,
-                       InteractionForceSources,
-                       OutVelIdx, OutDenIdx, OutPrsIdx); 
-	
-		Resources->VelocityIndex = OutVelIdx;
-		Resources->DensityIndex = OutDenIdx;
-		Resources->PressureIndex = OutPrsIdx; 
-		
-		// 시뮬레이션 결과를 바탕으로 렌더링 (ping-pong buffer)
-		Snapshot.DensityTexture = Resources->Density[OutDenIdx];
-		
-		if (Ext.IsValid())
-		{	
-			Ext->ApplyRenderState_RenderThread(Snapshot);
+		// 이전 프레임들에서 요청한 Density Readback 수신
+		Resources->PollDensityReadback();
+		
+		// Step이 없는 프레임은 Render State(보간 비율, Fog 인자)만 갱신
+		if (NumSubsteps > 0)
+		{
+			int32 InVelIdx = Resources->VelocityIndex;
+			int32 InDenIdx = Resources->DensityIndex;
+			int32 InPressIdx = Resources->PressureIndex;
+			
+			int32 OutVelIdx = InVelIdx, OutDenIdx = InDenIdx, OutPrsIdx = InPressIdx;
+			
+			if (InteractionSources.IsValid())
+			{
+				InteractionSources->TakeSources(SimParams.InteractionForceSources);
+			}
+			
+			// 시뮬레이션
+			UFluidSimulationComponent::AddSimulationFramePasses(GraphBuilder, Resources, SimParams, NumSubsteps,
+				InVelIdx, InDenIdx, InPressIdx,
+				OutVelIdx, OutDenIdx, OutPrsIdx);
+			
+			// Slot 할당 재사용 (Source는 기록 시점에 RDG upload buffer로 복사됨)
+			if (InteractionSources.IsValid())
+			{
+				InteractionSources->ReturnSources(MoveTemp(SimParams.InteractionForceSources));
+				InteractionSources.Reset();
+			}
+		
+			Resources->VelocityIndex = OutVelIdx;
+			Resources->DensityIndex = OutDenIdx;
+			Resources->PressureIndex = OutPrsIdx; 
 		}
+		
+		// 시뮬레이션 결과를 바탕으로 렌더링 (ping-pong buffer, 같은 PooledRT를 넘겨 RDG에 한 texture로 등록되도록)
+		Snapshot.DensityPooledRT = Resources->DensityPooledRT[Resources->DensityIndex];
+		Snapshot.DensityMaxMipPooledRT = Resources->DensityMaxMipPooledRT;
+		Snapshot.DensityHistoryPooledRT = SimParams.bDensityHistory ? Resources->DensityHistoryPooledRT : TRefCountPtr<IPooledRenderTarget>();
+		
+		Proxy.ApplyRenderState_RenderThread(Snapshot);
+	};
+	
+	ENQUEUE_RENDER_COMMAND(FFluidSimluationStep)(
+	[ Proxy, Update = MoveTemp(Update)](FRHICommandListImmediate& RHICmdList) mutable 
+	{
+		Proxy->QueueSimulationUpdate_RenderThread(RHICmdList, MoveTemp(Update));
 	}
 	);  
 }
 
+int32 UFluidSimulationComponent::PredictSimulationSubsteps(float DeltaTime, float MinStepInterval) const
+{
+	if (CPUSimulation.IsValid() || TimestepMode == EFluidSimulationTimestepMode::Variable)
+	{
+		return 1;
+	}
+	
+	float Accumulated = AccumulatedTime;
+	return FluidSimulationComponent::ConsumeFixedSubsteps(Accumulated, DeltaTime, GetFixedStepDeltaTime(MinStepInterval), FMath::Clamp(MaxSubsteps, 1, 8));
+}
+
+float UFluidSimulationComponent::GetFixedStepDeltaTime(float MinStepInterval) const
+{
+	return FMath::Max(1.0f / FMath::Clamp(SimulationRate, 10.0f, 240.0f), MinStepInterval);
+}
+
 void UFluidSimulationComponent::HandleInteractionBeginOverlap(UPrimitiveComponent* OverlappedComponent,
 	AActor* OtherActor, UPrimitiveComponent* OtherComp, int32 OtherBodyIndex, bool bFromSweep,
 	const FHitResult& SweepResult)
@@ -269,182 +732,50 @@ void UFluidSimulationComponent::HandleInteractionEndOverlap(UPrimitiveComponent*
 
 void UFluidSimulationComponent::AddInteractionActor(AActor* Actor, UPrimitiveComponent* Comp)
 {
-	if (!bEnableActorInteraction || !IsValid(Actor) || !IsValid(Comp) || Actor == GetOwner())
+	if (!bEnableActorInteraction || !InteractionTracker.IsValid() || !IsValid(Actor) || !IsValid(Comp) || Actor == GetOwner())
 	{
 		return;
 	}
 	
-	FTrackedFluidInteractionActor NewTracked;
-	NewTracked.InteractionActor = Actor;
-	NewTracked.Comp = Comp;
-	NewTracked.LastLocation = Comp->Bounds.Origin; 
-	
-	ActiveInteractionActors.Add(NewTracked);
+	InteractionTracker->Add(Comp);
 }
 
 void UFluidSimulationComponent::RemoveInteractionActor(AActor* Actor, UPrimitiveComponent* Comp)
 {
-	for (int32 Idx = ActiveInteractionActors.Num() - 1; Idx >= 0; --Idx)
+	if (InteractionTracker.IsValid())
 	{
-		FTrackedFluidInteractionActor & Tracked = ActiveInteractionActors[Idx]; 
-		
-		const bool bInvalid = !Tracked.InteractionActor.IsValid() || !Tracked.Comp.IsValid();
-		const bool bMatches = Tracked.InteractionActor.Get() == Actor && Tracked.Comp.Get() == Comp;
-	
-		if (bInvalid || bMatches)
-		{
-			ActiveInteractionActors.RemoveAtSwap(Idx);
-			return;
-		}
+		InteractionTracker->Remove(Comp);
 	}
 }
 
-bool UFluidSimulationComponent::WorldLocationToSimulationUV(const FVector& WorldLocation, const FVector& BoundsOrigin,
-	const FVector& BoundsExtents, FVector2f& OutUV)
+TSharedPtr<FFluidInteractionSourceSlot, ESPMode::ThreadSafe> UFluidSimulationComponent::KickInteractionSourceBuild(float DeltaTime)
 {
-	const FVector SafeExtents(BoundsExtents.X,BoundsExtents.Y, BoundsExtents.Z );
-	FVector2f UV;
-	UV.X = static_cast<float>((WorldLocation.X - BoundsOrigin.X + SafeExtents.X) / (SafeExtents.X * 2.0));
-	UV.Y = static_cast<float>((WorldLocation.Y - BoundsOrigin.Y + SafeExtents.Y) / (SafeExtents.Y * 2.0));
-	UV.Y = 1.0f - UV.Y;
+	if (!bEnableActorInteraction || !InteractionTracker.IsValid() || InteractionTracker->Num() == 0)
+	{
+		return nullptr;
+	}
 	
-	if (UV.X < 0.0f || UV.X > 1.0f || UV.Y < 0.0f || UV.Y > 1.0f)
+	FFluidInteractionBuildParams Params;
+	if (!ResolveSimulationBounds(Params.BoundsOrigin, Params.BoundsExtent))
 	{
-		return false;
+		return nullptr;
 	}
-	OutUV = UV;
-	return true; 
+	
+	Params.DeltaTime = DeltaTime;
+	Params.SimResolution = GetSimulationResolution();
+	Params.RadiusMultiplier = ActorInteractionRadiusMultiplier;
+	Params.ForceMultiplier = ActorInteractionForceMultiplier;
+	
+	return InteractionTracker->KickBuild(Params);
 }
 
-TArray<FFluidInteractionForceSource> UFluidSimulationComponent::BuildInteractionForceSources(float DeltaTime)
+bool UFluidSimulationComponent::TryResolveDirectionalLight(class ADirectionalLight*& OutLightActor) const
 {
-	TArray<FFluidInteractionForceSource> Sources;
-	
-	if (!bEnableActorInteraction)
+	OutLightActor = nullptr;
+	UWorld* World = GetWorld();
+	if (!World)
 	{
-		return Sources;
-	}
-	
-	FVector BoundsOrigin;
-	FVector BoundsExtents;
-	if ( !ResolveSimulationBounds(BoundsOrigin, BoundsExtents))
-	{
-		return Sources;	
-	}
-	
-	const float Width = FMath::Max(BoundsExtents.X * 2.0f, 1);
-	const float Height = FMath::Max(BoundsExtents.Y * 2.0f, 1);
-	
-	for (int32 Idx = ActiveInteractionActors.Num() - 1; Idx >= 0; --Idx)
-	{
-		FTrackedFluidInteractionActor & Tracked = ActiveInteractionActors[Idx];
-		AActor* Actor = Tracked.InteractionActor.Get();
-		UPrimitiveComponent* Comp = Tracked.Comp.Get();
-		
-		if (!IsValid(Comp) || !IsValid(Actor))
-		{
-			RemoveInteractionActor(Actor, Comp);
-			continue;
-		}
-		
-		const FVector CurrentLocation = Comp->Bounds.Origin;	
-		
-		FVector2f PositionUV;
-		if (!WorldLocationToSimulationUV(CurrentLocation, BoundsOrigin, BoundsExtents, PositionUV))
-		{
-			continue;
-		}
-		
-		FVector Velocity = Actor->GetVelocity(); 
-		
-		
-		const FVector FallbackVelocity = (CurrentLocation - Tracked.LastLocation) / DeltaTime;
-		
-		if (FallbackVelocity.SizeSquared2D() > Velocity.SizeSquared2D())
-		{
-			Velocity = FallbackVelocity;
-		}
-		
-		Tracked.LastLocation = CurrentLocation;
-		
-		if (Velocity.SizeSquared2D() <= 1e-3)
-		{
-			continue;
-		}
-		
-		UE_LOG(LogTemp, Warning,TEXT("Velocity: %.2f %.2f"), Velocity.X, Velocity.Y);
-			
-		// 속도를 volume 내 density field에서의 비율로 치환 
-		const FVector2f SimVelocity(
-			static_cast<float>(Velocity.X) / Width * SimResolution,
-			static_cast<float>(-Velocity.Y) / Height * SimResolution
-		); 
-		
-		const FVector2f Force = SimVelocity * ActorInteractionForceMultiplier;
-		
-		// bounds를 감싸는 box, sphere를 저장
-		const FBoxSphereBounds ComponentBounds = Comp->Bounds;
-		
-		const float RadiusXWorld = FMath::Max(static_cast<float>(ComponentBounds.BoxExtent.X) * ActorInteractionRadiusMultiplier, 1.0f);
-		const float RadiusYWorld = FMath::Max(static_cast<float>(ComponentBounds.BoxExtent.Y) * ActorInteractionRadiusMultiplier, 1.0f);
-			
-		const FVector2f RadiusUV (FMath::Max(RadiusXWorld / Width, 0.0f) , FMath::Max(RadiusYWorld / Height, 0.0f) );
- 		
-		// Debug For Add Force
-		 const FVector2f MoveDirUV = SimVelocity.GetSafeNormal();
-		 const FVector2f ForwardPositionUV(
-		 FMath::Clamp(PositionUV.X + MoveDirUV.X * RadiusUV.X * 2.5f, 0.0f, 1.0f),
-		 FMath::Clamp(PositionUV.Y + MoveDirUV.Y * RadiusUV.Y * 2.5f, 0.0f, 1.0f)	
-		 );
-		
-		const FVector ForwardWorldPosition(
-			BoundsOrigin.X + (ForwardPositionUV.X * 2.0f - 1.0f) * BoundsExtents.X,
-			BoundsOrigin.Y + (1.0f - ForwardPositionUV.Y * 2.0f) * BoundsExtents.Y,
-			CurrentLocation.Z	
-		);  
-		// DrawDebugSphere(
-		// 	GetWorld(),
-		// 	ForwardWorldPosition,
-		// 	30.0f,
-		// 	12,
-		// 	FColor::Cyan,
-		// 	false,
-		// 	0.0f,
-		// 	0,
-		// 	2.0f
-		// );
-		// DrawDebugLine(
-		// 	GetWorld(),
-		// 	CurrentLocation,
-		// 	ForwardWorldPosition,
-		// 	FColor::Cyan,
-		// 	false,
-		// 	0.0f,
-		// 	0,
-		// 	2.0f
-		// );
-		
-		FFluidInteractionForceSource Source;
-		Source.PositionRadius = FVector4f(ForwardPositionUV.X, ForwardPositionUV.Y, RadiusUV.X, RadiusUV.Y);
-		Source.ForceDensity = FVector4f(Force.X, Force.Y, 0.0f, 0.0f);
-		
-		if (Sources.Num() < MAX_FLUID_INTERACTION_FORCE_SOURCE)
-		{	
-			Sources.Add(Source); 
-		}
-	}
-
-	
-	return Sources;
-}
-
-bool UFluidSimulationComponent::TryResolveDirectionalLight(class ADirectionalLight*& OutLightActor) const
-{
-	OutLightActor = nullptr;
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return false;
+		return false;
 	}
 	if (DirectionalLightActor)
 	{
@@ -524,6 +855,14 @@ FFluidFogRenderState UFluidSimulationComponent::BuildFogRenderStateSnapShot() co
 	State.NumSteps = NumSteps;
 	State.MaxRayDistance = MaxRayDistance;
 	State.FogDebugMode = static_cast<int32>(FogDebugMode);
+	State.FogRenderMode = static_cast<int32>(FogRenderMode);
+	State.RayMarchDownsampleFactor = 1 << static_cast<int32>(RayMarchResolution);
+	State.UpsampleDepthTolerance = UpsampleDepthTolerance;
+	State.bTemporalRayMarch = bTemporalRayMarch;
+	State.TemporalHistoryWeight = TemporalHistoryWeight;
+	State.FroxelGridSize = FroxelGridSize;
+	State.FroxelHistoryWeight = FroxelHistoryWeight;
+	State.bEmptySpaceSkipping = bEmptySpaceSkipping;
 	FVector BoundsOrigin, BoundsExtents;
 	
 	if (ResolveSimulationBounds(BoundsOrigin, BoundsExtents))
@@ -555,12 +894,177 @@ FFluidFogRenderState UFluidSimulationComponent::BuildFogRenderStateSnapShot() co
 	State.SelfShadowDensityScale = SelfShadowDensityScale;
 	State.SelfShadowStepCount = SelfShadowStepCount;
 	State.SelfShadowMaxDistance = SelfShadowMaxDistance; 
+	State.bUseShadowVolume = bUseShadowVolume;
+	State.ShadowVolumeResolution = FIntVector(ShadowVolumeResolutionXY, ShadowVolumeResolutionXY, ShadowVolumeResolutionZ);
 	
 	// Phase Function
 	State.GOfHG = GOfHG;
 	return State;
 }
 
+FFluidSimulationParams UFluidSimulationComponent::BuildSimulationParamsSnapShot(float DeltaTime) const
+{
+	FFluidSimulationParams Params;
+	Params.DeltaTime = DeltaTime;
+	Params.Dissipation = Dissipation;
+	Params.VorticityStrength = VorticityStrengthParam;
+	Params.Viscosity = Viscosity;
+	Params.AdvectionMode = AdvectionMode;
+	
+	// Pressure Solve
+	Params.PressureSolverMode = PressureSolverMode;
+	Params.PressureIterations = PressureIterations;
+	Params.MultigridVCycles = MultigridVCycles;
+	Params.MultigridSmoothIterations = MultigridSmoothIterations;
+	Params.SOROmega = PressureSOROmega;
+	Params.bPressureWarmStart = bPressureWarmStart;
+	Params.PressureResidualTolerance = PressureResidualTolerance;
+	Params.MinPressureIterations = MinPressureIterations;
+	
+	// Density Maintenance
+	Params.bEnableDensityMaintenance = bEnableDensityMaintenance;
+	Params.BaseDensityTarget = BaseDensityTarget;
+	Params.BaseDensityRecoverySpeed = BaseDensityRecoverySpeed;
+	Params.BaseDensityDeadbandRatio = BaseDensityDeadbandRatio;
+	Params.BaseDensityNoiseRepeat = BaseDensityNoiseRepeat;
+	
+	if (BaseDensityNoiseTexture && BaseDensityNoiseTexture->GetResource())
+	{
+		Params.BaseDensityNoiseTexture = BaseDensityNoiseTexture->GetResource()->TextureRHI;
+	}
+	
+	// Density Readback
+	Params.bDensityReadback = bEnableDensityReadback
+		&& ResolveSimulationBounds(Params.SimulationBoundsOrigin, Params.SimulationBoundsExtent);
+	Params.DensityReadbackDownsample = FMath::Clamp(DensityReadbackDownsample, 1, 16);
+	
+	// Empty Space Skipping (Ray March에서만 사용)
+	Params.bDensityMaxMip = bEnableFog && bEmptySpaceSkipping && FogRenderMode == EFluidFogRenderMode::RayMarch;
+	Params.DensityMaxMipCellSize = FMath::Clamp(EmptySpaceSkipCellSize, 2, 64);
+	
+	// Sparse Active Tile (Density Maintenance는 모든 셀에 fog를 유지하므로 dense로)
+	Params.bActiveTiles = bEnableActiveTiles
+		&& !(bEnableDensityMaintenance && Params.BaseDensityNoiseTexture);
+	Params.ActiveTileDensityThreshold = FMath::Max(ActiveTileDensityThreshold, 0.0f);
+	Params.ActiveTileVelocityThreshold = FMath::Max(ActiveTileVelocityThreshold, 0.0f);
+	Params.ActiveTileDilation = FMath::Clamp(ActiveTileDilation, 0, 4);
+	
+	return Params;
+}
+
+FFluidSimulationPrecision UFluidSimulationComponent::GetSimulationPrecision() const
+{
+	FFluidSimulationPrecision Precision;
+	Precision.Velocity = VelocityPrecision;
+	Precision.Density = DensityPrecision;
+	Precision.Pressure = PressurePrecision;
+	return Precision;
+}
+
+bool UFluidSimulationComponent::ShouldUseCPUSimulation() const
+{
+	return bForceCPUSimulation || GUsingNullRHI || !FApp::CanEverRender();
+}
+
+int32 UFluidSimulationComponent::GetSimulationResolution() const
+{
+	if (CPUSimulation.IsValid())
+	{
+		return CPUSimResolution;
+	}
+	return ActiveSimResolution > 0 ? ActiveSimResolution : SimResolution;
+}
+
+void UFluidSimulationComponent::SetSimulationLODResolution(int32 InResolution)
+{
+	if (CPUSimulation.IsValid() || !FluidResources)
+	{
+		return;
+	}
+	
+	const int32 NewResolution = FMath::Clamp(InResolution, 16, SimResolution);
+	if (NewResolution == GetSimulationResolution())
+	{
+		return;
+	}
+	ActiveSimResolution = NewResolution;
+	
+	auto Resources = FluidResources;
+	ENQUEUE_RENDER_COMMAND(FResizeFluidResources)(
+		[Resources, NewResolution](FRHICommandListImmediate& RHICmdList)
+		{
+			Resources->Resize(NewResolution, RHICmdList);
+		});
+}
+
+float UFluidSimulationComponent::EstimateSimulationGPUMilliseconds(int32 Resolution) const
+{
+	const float MeasuredPerMegaCell = FluidResources
+		? FluidResources->GPUMillisecondsPerMegaCell.load(std::memory_order_relaxed)
+		: 0.0f;
+	const float PerMegaCell = MeasuredPerMegaCell > 0.0f
+		? MeasuredPerMegaCell
+		: FluidSimulationComponent::DefaultGPUMillisecondsPerMegaCell;
+	
+	return PerMegaCell * static_cast<float>(FMath::Square(static_cast<double>(Resolution)) / 1.0e6);
+}
+
+void UFluidSimulationComponent::InitCPUSimulation()
+{
+	TArray<float> NoiseValues;
+	int32 NoiseWidth = 0;
+	int32 NoiseHeight = 0;
+	
+	if (bEnableDensityMaintenance && BaseDensityNoiseTexture
+		&& !FluidSimulationComponent::ReadTextureRedChannel(BaseDensityNoiseTexture, NoiseValues, NoiseWidth, NoiseHeight))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("InitCPUSimulation: BaseDensityNoiseTexture is not CPU readable (B8G8R8A8 / G8), density maintenance disabled"));
+	}
+	
+	DensitySnapshot = MakeShared<FFluidDensitySnapshot, ESPMode::ThreadSafe>();
+	CPUSimulation = MakeShared<FFluidSimulationCPUWorker, ESPMode::ThreadSafe>(DensitySnapshot.ToSharedRef());
+	CPUSimulation->Init(CPUSimResolution, MoveTemp(NoiseValues), NoiseWidth, NoiseHeight);
+	CPUSimulationPendingDeltaTime = 0.0f;
+}
+
+void UFluidSimulationComponent::TickCPUSimulation(float DeltaTime)
+{
+	CPUSimulationPendingDeltaTime = FMath::Min(CPUSimulationPendingDeltaTime + DeltaTime,
+		FluidSimulationComponent::MaxCPUSimulationDeltaTime);
+	
+	// 이전 스텝이 끝나지 않았으면 시간만 누적 (tick당 CPU 비용 상한)
+	if (CPUSimulation->IsStepInFlight() || CPUSimulationPendingDeltaTime <= 0.0f)
+	{
+		return;
+	}
+	
+	FVector BoundsOrigin;
+	FVector BoundsExtents;
+	if (!ResolveSimulationBounds(BoundsOrigin, BoundsExtents))
+	{
+		return;
+	}
+	
+	const float StepDeltaTime = CPUSimulationPendingDeltaTime;
+	CPUSimulationPendingDeltaTime = 0.0f;
+	
+	FFluidSimulationParams SimParams = BuildSimulationParamsSnapShot(StepDeltaTime);
+	SimParams.BaseDensityNoiseTexture = nullptr;
+	
+	CPUSimulation->KickStep(MoveTemp(SimParams), BoundsOrigin, BoundsExtents, KickInteractionSourceBuild(StepDeltaTime));
+}
+
+float UFluidSimulationComponent::SampleDensityAtWorldLocation(const FVector& WorldLocation) const
+{
+	const TSharedPtr<FFluidDensitySnapshot, ESPMode::ThreadSafe> Snapshot = DensitySnapshot;
+	return Snapshot.IsValid() ? Snapshot->SampleAtWorldLocation(WorldLocation) : 0.0f;
+}
+
+float UFluidSimulationComponent::GetFogDensityAtLocation(const FVector& WorldLocation) const
+{
+	return SampleDensityAtWorldLocation(WorldLocation);
+}
+
 TArray<float> UFluidSimulationComponent::BuildHeightCurveSamples() const
 {
 	const int32 LUTWidth = FMath::Max(HeightCurveLUTResolution, 2);
@@ -594,91 +1098,110 @@ TArray<float> UFluidSimulationComponent::BuildHeightCurveSamples() const
 	return Samples;
 }
 
-void UFluidSimulationComponent::PushHeightCurveSamplesToFogExtension()
+void UFluidSimulationComponent::PushHeightCurveSamplesToFogProxy()
 {
-	if (!FogExtension.IsValid())
+	if (!FogRenderProxy.IsValid())
 	{
 		return;
 	}
 
 	// Curve Data를 Array<Float>로 받아오기
 	TArray<float> Samples = BuildHeightCurveSamples();
-	TSharedPtr<FFogSceneViewExtension, ESPMode::ThreadSafe> LocalFogExtension = FogExtension;
+	TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe> LocalFogRenderProxy = FogRenderProxy;
 
 	ENQUEUE_RENDER_COMMAND(FPushFogHeightCurveSamples)(
-			[LocalFogExtension, Samples = MoveTemp(Samples)](FRHICommandListImmediate& RHICmdList) mutable
+			[LocalFogRenderProxy, Samples = MoveTemp(Samples)](FRHICommandListImmediate& RHICmdList) mutable
 			{
-					if (LocalFogExtension.IsValid())
+					if (LocalFogRenderProxy.IsValid())
 					{
-						LocalFogExtension->UpdateHeightCurveLUT_RenderThread(RHICmdList, MakeArrayView(Samples));
+						LocalFogRenderProxy->UpdateHeightCurveLUT_RenderThread(RHICmdList, MakeArrayView(Samples));
 					}
 			});
 }
 
-void UFluidSimulationComponent::ReleaseHeightCurveFromFogExtension()
+void UFluidSimulationComponent::ReleaseHeightCurveFromFogProxy()
 { 
-	if (!FogExtension.IsValid())
+	if (!FogRenderProxy.IsValid())
 	{
 		return;
 	}
 
-	TSharedPtr<FFogSceneViewExtension, ESPMode::ThreadSafe> LocalFogExtension = FogExtension;
+	TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe> LocalFogRenderProxy = FogRenderProxy;
 
 	ENQUEUE_RENDER_COMMAND(FReleaseFogHeightCurve)(
-			[LocalFogExtension](FRHICommandListImmediate& RHICmdList)
+			[LocalFogRenderProxy](FRHICommandListImmediate& RHICmdList)
 			{
-					if (LocalFogExtension.IsValid())
+					if (LocalFogRenderProxy.IsValid())
 					{
-							LocalFogExtension->ReleaseHeightCurveLUT_RenderThread();
+							LocalFogRenderProxy->ReleaseHeightCurveLUT_RenderThread();
 					}
 			});
 }
 
-void UFluidSimulationComponent::ExecuteSimulationRDG(FRHICommandListImmediate& RHICmdList,
-	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources, float DeltaTime, int32 InVelIndex,
-	int32 InDenIndex, int32 InPresIndex, float InDissipation,  
-	float InVorticityStrength, float InVisc, int32 InPressureIterations,
-	bool bInEnableDensityMaintenance, FTextureRHIRef InBaseDensityNoiseTexture, float InBaseDensityTarget,
-	float InBaseDensityRecoverySpeed, float InBaseDensityDeadbandRatio, float InBaseDensityNoiseRepeat,
-	const TArray<FFluidInteractionForceSource>& InInteractionForceSources, int32& OutVelIndex, int32& OutDenIndex,
-	int32& OutPresIndex)
+void UFluidSimulationComponent::AddSimulationFramePasses(FRDGBuilder& GraphBuilder,
+	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources, const FFluidSimulationParams& SimParams,
+	int32 NumSubsteps,
+	int32 InVelIndex, int32 InDenIndex, int32 InPresIndex,
+	int32& OutVelIndex, int32& OutDenIndex, int32& OutPresIndex)
 {
-	FRDGBuilder GraphBuilder(RHICmdList);
+	// 이전 step들의 GPU 시간 수신 (UFluidFogSubsystem 예산)
+	FluidResources->PollGPUTimer();
 	
-	AddSimulationPasses(
-	   GraphBuilder,
-	   FluidResources,
-	   DeltaTime,
-	   InVelIndex,
-	   InDenIndex,
-	   InPresIndex,
-	   InDissipation,  
-	   InVorticityStrength,
-	   InVisc,
-	   InPressureIterations,
-	   bInEnableDensityMaintenance,
-	   InBaseDensityNoiseTexture,
-	   InBaseDensityTarget,
-	   InBaseDensityRecoverySpeed,
-	   InBaseDensityDeadbandRatio,
-	   InBaseDensityNoiseRepeat,
-	   InInteractionForceSources,
-	   OutVelIndex,
-	   OutDenIndex,
-	   OutPresIndex);
-
-	GraphBuilder.Execute();
+	RDG_EVENT_SCOPE_STAT(GraphBuilder, VFF_FluidSimulation, "VFF_FluidSimulation %dx%d x%d", FluidResources->Resolution, FluidResources->Resolution, NumSubsteps);
+	RDG_GPU_STAT_SCOPE(GraphBuilder, VFF_FluidSimulation);
+	
+	// Timestamp는 graph 실행 시점에 (Frame graph에서는 기록과 실행 사이에 다른 pass들이 있음)
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("VFF_Fluid.BeginGPUTimer"),
+		ERDGPassFlags::NeverCull,
+		[FluidResources](FRHICommandListImmediate& RHICmdList)
+		{
+			FluidResources->BeginGPUTimer(RHICmdList);
+		});
+	
+	// Substep은 같은 graph에서 ping-pong index만 이어감 (중간 결과는 Readback / 최대값 Mip 생략)
+	FFluidSimulationParams SubstepParams = SimParams;
+	OutVelIndex = InVelIndex;
+	OutDenIndex = InDenIndex;
+	OutPresIndex = InPresIndex;
+	
+	// Source는 substep 동안 같으므로 Interaction force binning은 프레임마다 한 번 (TileClassify / Force pass 입력)
+	const FluidSimulationComponent::FInteractionForceBinBuffers ForceBins =
+		FluidSimulationComponent::CreateInteractionForceBinBuffers(GraphBuilder, SimParams, FluidResources->Resolution);
+	
+	for (int32 Substep = 0; Substep < NumSubsteps; ++Substep)
+	{
+		SubstepParams.bFinalSubstep = Substep == NumSubsteps - 1;
+		
+		AddSimulationPasses(
+		   GraphBuilder,
+		   FluidResources,
+		   SubstepParams,
+		   ForceBins,
+		   OutVelIndex,
+		   OutDenIndex,
+		   OutPresIndex,
+		   OutVelIndex,
+		   OutDenIndex,
+		   OutPresIndex);
+	}
+	
+	GraphBuilder.AddPass(
+		RDG_EVENT_NAME("VFF_Fluid.EndGPUTimer"),
+		ERDGPassFlags::NeverCull,
+		[FluidResources, NumSubsteps](FRHICommandListImmediate& RHICmdList)
+		{
+			FluidResources->EndGPUTimer(RHICmdList, NumSubsteps);
+		});
 }
 
 void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
-	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources, float DeltaTime, int32 InVelIndex,
-	int32 InDenIndex, int32 InPresIndex, float InDissipation, 
-	float InVorticityStrength, float InVisc, int32 InPressureIterations,
-	bool bInEnableDensityMaintenance, FTextureRHIRef InBaseDensityNoiseTexture, float InBaseDensityTarget,
-	float InBaseDensityRecoverySpeed, float InBaseDensityDeadbandRatio, float InBaseDensityNoiseRepeat,
-	const TArray<FFluidInteractionForceSource>& InInteractionForceSources, int32& OutVelIndex, int32& OutDenIndex,
-	int32& OutPresIndex)
+	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources, const FFluidSimulationParams& SimParams,
+	const FluidSimulationComponent::FInteractionForceBinBuffers& ForceBins,
+	int32 InVelIndex, int32 InDenIndex, int32 InPresIndex,
+	int32& OutVelIndex, int32& OutDenIndex, int32& OutPresIndex)
 {
+	const float DeltaTime = SimParams.DeltaTime;
 	const int32 Resolution = FluidResources->Resolution;
 	const float Dx = 1.0f / static_cast<float>(Resolution);
 	const float HalfInvDx = 0.5f * static_cast<float>(Resolution);
@@ -698,10 +1221,10 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 	TRefCountPtr<IPooledRenderTarget> BaseDensityNoisePooledRT;
 	FRDGTextureRef BaseDensityNoise = BlackFallback;
 
-	if (InBaseDensityNoiseTexture)
+	if (SimParams.BaseDensityNoiseTexture)
 	{
 		BaseDensityNoisePooledRT = CreateRenderTarget(
-			InBaseDensityNoiseTexture,
+			SimParams.BaseDensityNoiseTexture,
 			TEXT("FluidBaseDensityNoise"));
 
 		BaseDensityNoise = GraphBuilder.RegisterExternalTexture(
@@ -739,69 +1262,168 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 		FluidResources->PressurePooledRT[0],
 		TEXT("FluidPressureA"),
 		ERDGTextureFlags::MultiFrame),
-
-	GraphBuilder.RegisterExternalTexture(
-		FluidResources->PressurePooledRT[1],
-		TEXT("FluidPressureB"),
-		ERDGTextureFlags::MultiFrame)
+		nullptr
+	};
+	
+	// In-place(Red-Black SOR)로 초기화된 상태에서 ping-pong solver를 쓰면 transient texture로 대체
+	const bool bTransientPressure = !FluidResources->PressurePooledRT[1].IsValid();
+	if (bTransientPressure)
+	{
+		Pressure[1] = GraphBuilder.CreateTexture(Pressure[0]->Desc, TEXT("FluidPressureB"));
+	}
+	else
+	{
+		Pressure[1] = GraphBuilder.RegisterExternalTexture(
+			FluidResources->PressurePooledRT[1],
+			TEXT("FluidPressureB"),
+			ERDGTextureFlags::MultiFrame);
+	}
+	
+	// Dense step은 Divergence / TempVelocity를 step 안에서만 쓰므로 transient (RDG가 frame graph의 다른 texture와 alias)
+	// Active tile은 비활성 tile의 0을 다음 step까지 유지해야 하므로 persistent (새로 만들면 TileMask를 무효화해 전부 정리)
+	auto RegisterScratchTexture = [&](TRefCountPtr<IPooledRenderTarget>& PooledRT, EPixelFormat Format, const TCHAR* Name) -> FRDGTextureRef
+	{
+		const FRDGTextureDesc Desc = FRDGTextureDesc::Create2D(
+			ResolutionPt,
+			Format,
+			FClearValueBinding::None,
+			TexCreate_ShaderResource | TexCreate_UAV);
+		
+		if (!SimParams.bActiveTiles)
+		{
+			PooledRT.SafeRelease();
+			return GraphBuilder.CreateTexture(Desc, Name);
+		}
+		
+		if (PooledRT.IsValid() && PooledRT->GetDesc().Extent == Desc.Extent && PooledRT->GetDesc().Format == Format)
+		{
+			return GraphBuilder.RegisterExternalTexture(PooledRT, Name, ERDGTextureFlags::MultiFrame);
+		}
+		
+		FRDGTextureRef Texture = GraphBuilder.CreateTexture(Desc, Name);
+		PooledRT = GraphBuilder.ConvertToExternalTexture(Texture);
+		FluidResources->bTileMaskValid = false;
+		return Texture;
 	};
 	
-	FRDGTextureRef Divergence = GraphBuilder.RegisterExternalTexture(
-	FluidResources->DivergencePooledRT,
-	TEXT("FluidDivergence"),
-	ERDGTextureFlags::MultiFrame);
+	FRDGTextureRef Divergence = RegisterScratchTexture(FluidResources->DivergencePooledRT, Pressure[0]->Desc.Format, TEXT("FluidDivergence"));
+	FRDGTextureRef TempVelocity = RegisterScratchTexture(FluidResources->TempVelocityPooledRT, Velocity[0]->Desc.Format, TEXT("FluidTempVelocity"));
 
-	FRDGTextureRef TempVelocity = GraphBuilder.RegisterExternalTexture(
-		FluidResources->TempVelocityPooledRT,
-		TEXT("FluidTempVelocity"),
-		ERDGTextureFlags::MultiFrame);
+	// Interpolated timestep: 마지막 substep 직전 Density 보관 (렌더링이 이 Density와 결과 사이를 보간)
+	FRDGTextureRef DensityHistory = nullptr;
+	if (SimParams.bFinalSubstep)
+	{
+		if (SimParams.bDensityHistory)
+		{
+			const FRDGTextureDesc& HistoryDesc = Density[InDenIndex]->Desc;
+			TRefCountPtr<IPooledRenderTarget>& HistoryPooledRT = FluidResources->DensityHistoryPooledRT;
+			if (HistoryPooledRT.IsValid() && HistoryPooledRT->GetDesc().Extent == HistoryDesc.Extent
+				&& HistoryPooledRT->GetDesc().Format == HistoryDesc.Format)
+			{
+				DensityHistory = GraphBuilder.RegisterExternalTexture(HistoryPooledRT, TEXT("FluidDensityHistory"));
+			}
+			else
+			{
+				DensityHistory = GraphBuilder.CreateTexture(HistoryDesc, TEXT("FluidDensityHistory"));
+				HistoryPooledRT = GraphBuilder.ConvertToExternalTexture(DensityHistory);
+			}
+			AddCopyTexturePass(GraphBuilder, Density[InDenIndex], DensityHistory);
+		}
+		else
+		{
+			FluidResources->DensityHistoryPooledRT.SafeRelease();
+		}
+	}
+	
+	// Sparse Active Tile: per-cell pass는 활성 tile만 dispatch
+	FluidSimulationComponent::FTileDispatch TileDispatch;
+	TileDispatch.GroupCount = GroupCount;
+	
+	if (SimParams.bActiveTiles)
+	{
+		AddActiveTilePasses(
+			GraphBuilder,
+			FluidResources,
+			SimParams,
+			Velocity,
+			Density,
+			Pressure,
+			Divergence,
+			TempVelocity,
+			InVelIndex,
+			InDenIndex,
+			ForceBins.TileSourceOffsets,
+			TileDispatch.ActiveTileList,
+			TileDispatch.ActiveTileArgs);
+	}
+	else
+	{
+		// Dense 프레임은 모든 tile을 갱신하므로 다음 tiled 프레임에서 다시 정리
+		FluidResources->bTileMaskValid = false;
+	}
 
 	int32 CurVelIdx = InVelIndex;
 	int32 CurDenIdx = InDenIndex;
 	int32 CurPresIdx = InPresIndex; 
 	
+	const bool bMacCormack = SimParams.AdvectionMode == EFluidAdvectionMode::MacCormack;
 	
 	{
 		const int32 NextVelIdx = 1 - CurVelIdx;
 
-		TShaderMapRef<FFluidAdvectVelocityCS> Shader(
-			GetGlobalShaderMap(GMaxRHIFeatureLevel));
-
 		auto* Params = GraphBuilder.AllocParameters<
 			FFluidAdvectVelocityCS::FParameters>();
 
+		// MacCormack: semi-Lagrangian 결과는 예측값으로만 쓰므로 TempVelocity에 (Viscosity보다 먼저 끝남)
 		Params->VelocityInput = Velocity[CurVelIdx];
-		Params->VelocityOutput = GraphBuilder.CreateUAV(Velocity[NextVelIdx]);
+		Params->VelocityOutput = GraphBuilder.CreateUAV(bMacCormack ? TempVelocity : Velocity[NextVelIdx]);
 		Params->BilinearSampler =
 			TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
 		Params->DeltaTime = DeltaTime;
 		Params->InvResolution = InvResolution;
 		Params->Resolution = ResolutionPt;
 
-		FComputeShaderUtils::AddPass(
+		FluidSimulationComponent::AddTiledPass<FFluidAdvectVelocityCS>(
 			GraphBuilder,
 			RDG_EVENT_NAME("VFF_Fluid.AdvectVelocity"),
-			Shader,
-			Params,
-			GroupCount);
+			TileDispatch,
+			Params);
+		
+		if (bMacCormack)
+		{
+			auto* CorrectParams = GraphBuilder.AllocParameters<
+				FFluidMacCormackVelocityCS::FParameters>();
+			
+			CorrectParams->VelocityInput = Velocity[CurVelIdx];
+			CorrectParams->PredictedInput = TempVelocity;
+			CorrectParams->Output = GraphBuilder.CreateUAV(Velocity[NextVelIdx]);
+			CorrectParams->BilinearSampler =
+				TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+			CorrectParams->DeltaTime = DeltaTime;
+			CorrectParams->InvResolution = InvResolution;
+			CorrectParams->Resolution = ResolutionPt;
+			
+			FluidSimulationComponent::AddTiledPass<FFluidMacCormackVelocityCS>(
+				GraphBuilder,
+				RDG_EVENT_NAME("VFF_Fluid.AdvectVelocityMacCormack"),
+				TileDispatch,
+				CorrectParams);
+		}
 
 		CurVelIdx = NextVelIdx;
 	}
 	// Viscosity
-	if (InVisc > 0.0f)
+	if (SimParams.Viscosity > 0.0f)
 	{
 		AddCopyTexturePass(
 			GraphBuilder,
 			Velocity[CurVelIdx],
 			TempVelocity);
 
-		const float A = DeltaTime * InVisc / (Dx * Dx);
+		const float A = DeltaTime * SimParams.Viscosity / (Dx * Dx);
 		const float ViscAlpha = 1.0f / A;
 		const float ViscInvBeta = 1.0f / (4.0f + ViscAlpha);
 
-		TShaderMapRef<FFluidDiffuseVelocityCS> Shader(
-			GetGlobalShaderMap(GMaxRHIFeatureLevel));
-
 		for (int32 Iteration = 0; Iteration < 5; ++Iteration)
 		{
 			const int32 NextVelIdx = 1 - CurVelIdx;
@@ -816,12 +1438,11 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 			Params->InvBeta = ViscInvBeta;
 			Params->Resolution = ResolutionPt;
 
-			FComputeShaderUtils::AddPass(
+			FluidSimulationComponent::AddTiledPass<FFluidDiffuseVelocityCS>(
 				GraphBuilder,
 				RDG_EVENT_NAME("VFF_Fluid.DiffuseVelocity %d", Iteration),
-				Shader,
-				Params,
-				GroupCount);
+				TileDispatch,
+				Params);
 
 			CurVelIdx = NextVelIdx;
 		}
@@ -832,9 +1453,6 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 		const int32 NextVelIdx = 1 - CurVelIdx;
 	    const int32 NextDenIdx = 1 - CurDenIdx;
 
-	    TShaderMapRef<FFluidForceCS> Shader(
-	        GetGlobalShaderMap(GMaxRHIFeatureLevel));
-
 	    auto* Params = GraphBuilder.AllocParameters<
 	        FFluidForceCS::FParameters>();
 
@@ -844,32 +1462,21 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 	    Params->DensityOutput = GraphBuilder.CreateUAV(Density[NextDenIdx]);
 
 	    Params->DeltaTime = DeltaTime;
-	    Params->Dissipation = InDissipation;
+	    Params->Dissipation = SimParams.Dissipation;
   
-	    const uint32 SourceCount = FMath::Min(
-	        InInteractionForceSources.Num(),
-	        MAX_FLUID_INTERACTION_FORCE_SOURCE);
-
-	    Params->InteractionForceSourceCount = SourceCount;
-
-	    for (uint32 SourceIndex = 0; SourceIndex < SourceCount; ++SourceIndex)
-	    {
-	        Params->InteractionForcePositionRadius[SourceIndex] =
-	            InInteractionForceSources[SourceIndex].PositionRadius;
-
-	        Params->InteractionForceVectorDensity[SourceIndex] =
-	            InInteractionForceSources[SourceIndex].ForceDensity;
-	    }
+	    Params->InteractionForceSources = ForceBins.Sources;
+	    Params->ForceTileSourceOffsets = ForceBins.TileSourceOffsets;
+	    Params->ForceTileSourceIndices = ForceBins.TileSourceIndices;
+	    Params->NumForceTiles = ForceBins.NumTiles;
 
 	    Params->InvResolution = InvResolution;
 	    Params->Resolution = ResolutionPt;
 
-	    FComputeShaderUtils::AddPass(
+	    FluidSimulationComponent::AddTiledPass<FFluidForceCS>(
 	        GraphBuilder,
 	        RDG_EVENT_NAME("VFF_Fluid.Force"),
-	        Shader,
-	        Params,
-	        GroupCount);
+	        TileDispatch,
+	        Params);
 
 	    CurVelIdx = NextVelIdx;
 	    CurDenIdx = NextDenIdx;
@@ -877,9 +1484,6 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 	
 	// Divergence 
 	{
-		TShaderMapRef<FFluidDivergenceCS> Shader(
-		GetGlobalShaderMap(GMaxRHIFeatureLevel));
-
 		auto* Params = GraphBuilder.AllocParameters<
 			FFluidDivergenceCS::FParameters>();
 
@@ -888,36 +1492,127 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 		Params->Resolution = ResolutionPt;
 		Params->HalfInvDx = HalfInvDx;
 
-		FComputeShaderUtils::AddPass(
+		FluidSimulationComponent::AddTiledPass<FFluidDivergenceCS>(
 			GraphBuilder,
 			RDG_EVENT_NAME("VFF_Fluid.Divergence"),
-			Shader,
-			Params,
-			GroupCount);
+			TileDispatch,
+			Params);
 
 	}
 	
 	// Pressure solve
 	{
-		AddClearUAVPass(
-	GraphBuilder,
-	GraphBuilder.CreateUAV(Pressure[0]),
-	FVector4f::Zero());
+		const bool bRedBlackSOR = SimParams.PressureSolverMode == EFluidPressureSolverMode::RedBlackSOR;
+		const bool bMultigrid = SimParams.PressureSolverMode == EFluidPressureSolverMode::Multigrid;
+		const bool bFusedJacobi = SimParams.PressureSolverMode == EFluidPressureSolverMode::FusedJacobi;
+		const bool bWarmStart = SimParams.bPressureWarmStart && FluidResources->bPressureHistoryValid;
+		
+		// Multigrid는 V-Cycle 수, 나머지는 sweep 수
+		const int32 MaxIterations = FMath::Max(bMultigrid ? SimParams.MultigridVCycles : SimParams.PressureIterations, 1);
+		int32 NumIterations = MaxIterations;
+		
+		if (SimParams.bPressureWarmStart)
+		{
+			int32& Adaptive = FluidResources->AdaptivePressureIterations;
+			Adaptive = Adaptive > 0 ? Adaptive : MaxIterations;
+			
+			float RelativeResidual = 0.0f;
+			if (FluidResources->PollPressureResidual(RelativeResidual))
+			{
+				SET_FLOAT_STAT(STAT_VFF_PressureResidual, RelativeResidual);
+				
+				// 수렴했으면 조금씩 줄이고, 아니면 빠르게 늘림
+				Adaptive = RelativeResidual < SimParams.PressureResidualTolerance
+					? Adaptive - FMath::Max(1, Adaptive / 4)
+					: Adaptive + FMath::Max(1, Adaptive / 2);
+			}
+			
+			const int32 MinIterations = FMath::Clamp(SimParams.MinPressureIterations, 1, MaxIterations);
+			Adaptive = FMath::Clamp(Adaptive, MinIterations, MaxIterations);
+			NumIterations = Adaptive;
+		}
+		
+		INC_DWORD_STAT_BY(STAT_VFF_PressureIterations, NumIterations);
+		
+		if (bWarmStart)
+		{
+			// 이전 프레임의 해를 그대로 초기값으로 사용
+			CurPresIdx = InPresIndex;
+		}
+		else
+		{
+			AddClearUAVPass(
+				GraphBuilder,
+				GraphBuilder.CreateUAV(Pressure[0]),
+				FVector4f::Zero());
 
-		AddClearUAVPass(
-			GraphBuilder,
-			GraphBuilder.CreateUAV(Pressure[1]),
-			FVector4f::Zero());
+			if (!bRedBlackSOR)
+			{
+				AddClearUAVPass(
+					GraphBuilder,
+					GraphBuilder.CreateUAV(Pressure[1]),
+					FVector4f::Zero());
+			}
 
-		CurPresIdx = 0;
+			CurPresIdx = 0;
+		}
 
 		const float Alpha = -(Dx * Dx);
 		const float InvBeta = 0.25f;
 
-		TShaderMapRef<FFluidDiffuseCS> Shader(
-			GetGlobalShaderMap(GMaxRHIFeatureLevel));
-
-		for (int32 Iteration = 0; Iteration < InPressureIterations; ++Iteration)
+		const int32 NumJacobiIterations =
+			SimParams.PressureSolverMode == EFluidPressureSolverMode::Jacobi ? NumIterations : 0;
+		
+		if (bMultigrid)
+		{
+			AddPressureMultigridPasses(
+				GraphBuilder,
+				Pressure,
+				CurPresIdx,
+				Divergence,
+				Resolution,
+				NumIterations,
+				SimParams.MultigridSmoothIterations);
+		}
+		
+		if (bRedBlackSOR)
+		{
+			TShaderMapRef<FFluidPressureRedBlackCS> RedBlackShader(
+				GetGlobalShaderMap(GMaxRHIFeatureLevel));
+			
+			// 한 번의 dispatch는 같은 색의 셀(절반)만 갱신
+			const FIntVector HalfGroupCount(
+				FMath::DivideAndRoundUp(FMath::DivideAndRoundUp(Resolution, 2), 8),
+				FMath::DivideAndRoundUp(Resolution, 8),
+				1);
+			
+			FRDGTextureUAVRef PressureUAV = GraphBuilder.CreateUAV(Pressure[CurPresIdx]);
+			
+			for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+			{
+				for (uint32 Parity = 0; Parity < 2; ++Parity)
+				{
+					auto* Params = GraphBuilder.AllocParameters<
+						FFluidPressureRedBlackCS::FParameters>();
+					
+					Params->DivergenceInput = Divergence;
+					Params->Pressure = PressureUAV;
+					Params->Alpha = Alpha;
+					Params->Omega = SimParams.SOROmega;
+					Params->Parity = Parity;
+					Params->Resolution = ResolutionPt;
+					
+					FComputeShaderUtils::AddPass(
+						GraphBuilder,
+						RDG_EVENT_NAME("VFF_Fluid.PressureSOR %d %s", Iteration, Parity == 0 ? TEXT("Red") : TEXT("Black")),
+						RedBlackShader,
+						Params,
+						HalfGroupCount);
+				}
+			}
+		}
+		
+		for (int32 Iteration = 0; Iteration < NumJacobiIterations; ++Iteration)
 		{
 			const int32 NextPresIdx = 1 - CurPresIdx;
 
@@ -931,24 +1626,68 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 			Params->InvBeta = InvBeta;
 			Params->Resolution = ResolutionPt;
 
-			FComputeShaderUtils::AddPass(
+			FluidSimulationComponent::AddTiledPass<FFluidDiffuseCS>(
 				GraphBuilder,
 				RDG_EVENT_NAME("VFF_Fluid.Pressure %d", Iteration),
-				Shader,
-				Params,
-				GroupCount);
+				TileDispatch,
+				Params);
 
 			CurPresIdx = NextPresIdx;
 		}
+		
+		if (bFusedJacobi)
+		{
+			TShaderMapRef<FFluidDiffuseTiledCS> TiledShader(
+				GetGlobalShaderMap(GMaxRHIFeatureLevel));
+			
+			// Dispatch 한 번에 최대 MaxIterationsPerDispatch 번 반복
+			for (int32 Iteration = 0; Iteration < NumIterations; Iteration += FFluidDiffuseTiledCS::MaxIterationsPerDispatch)
+			{
+				const int32 NextPresIdx = 1 - CurPresIdx;
+				const int32 NumFused = FMath::Min(NumIterations - Iteration, FFluidDiffuseTiledCS::MaxIterationsPerDispatch);
+				
+				auto* Params = GraphBuilder.AllocParameters<
+					FFluidDiffuseTiledCS::FParameters>();
+				
+				Params->InputTexture = Pressure[CurPresIdx];
+				Params->PrevTexture = Divergence;
+				Params->OutputTexture = GraphBuilder.CreateUAV(Pressure[NextPresIdx]);
+				Params->Alpha = Alpha;
+				Params->InvBeta = InvBeta;
+				Params->Resolution = ResolutionPt;
+				Params->NumIterations = static_cast<uint32>(NumFused);
+				
+				FComputeShaderUtils::AddPass(
+					GraphBuilder,
+					RDG_EVENT_NAME("VFF_Fluid.PressureFused %d-%d", Iteration, Iteration + NumFused - 1),
+					TiledShader,
+					Params,
+					GroupCount);
+				
+				CurPresIdx = NextPresIdx;
+			}
+		}
+		
+		// Transient Pressure[1]은 다음 프레임까지 남지 않으므로 결과를 Pressure[0]으로 옮김
+		if (bTransientPressure && CurPresIdx == 1)
+		{
+			AddCopyTexturePass(GraphBuilder, Pressure[1], Pressure[0]);
+			CurPresIdx = 0;
+		}
+		
+		FluidResources->bPressureHistoryValid = true;
+		
+		// 다음 프레임들의 반복 횟수 조절을 위한 residual 측정 (비동기 readback, 마지막 substep만)
+		if (SimParams.bPressureWarmStart && SimParams.bFinalSubstep && FluidResources->PressureResidualPendingCount < FFluidResources::NumPressureResidualReadbacks)
+		{
+			AddPressureResidualReadbackPass(GraphBuilder, FluidResources, Pressure[CurPresIdx], Divergence, Resolution);
+		}
 	}
 	
 	// Gradient subtract 
 	{
 		const int32 NextVelIdx = 1 - CurVelIdx;
 
-		TShaderMapRef<FFluidGradientSubtractCS> Shader(
-			GetGlobalShaderMap(GMaxRHIFeatureLevel));
-
 		auto* Params = GraphBuilder.AllocParameters<
 			FFluidGradientSubtractCS::FParameters>();
 
@@ -958,12 +1697,11 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 		Params->Resolution = ResolutionPt;
 		Params->HalfInvDx = HalfInvDx;
 
-		FComputeShaderUtils::AddPass(
+		FluidSimulationComponent::AddTiledPass<FFluidGradientSubtractCS>(
 			GraphBuilder,
 			RDG_EVENT_NAME("VFF_Fluid.GradientSubtract"),
-			Shader,
-			Params,
-			GroupCount);
+			TileDispatch,
+			Params);
 
 		CurVelIdx = NextVelIdx; 
 	}
@@ -972,33 +1710,61 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 	{
 		const int32 NextDenIdx = 1 - CurDenIdx;
 
-		TShaderMapRef<FFluidAdvectCS> Shader(
-			GetGlobalShaderMap(GMaxRHIFeatureLevel));
-
 		auto* Params = GraphBuilder.AllocParameters<
 			FFluidAdvectCS::FParameters>();
+		
+		FRDGTextureRef PredictedDensity = bMacCormack
+			? GraphBuilder.CreateTexture(Density[NextDenIdx]->Desc, TEXT("FluidDensityPredicted"))
+			: Density[NextDenIdx];
+		
+		// 보정 pass가 주변 texel도 읽으므로 비활성 tile을 0으로
+		if (bMacCormack && TileDispatch.ActiveTileList)
+		{
+			AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(PredictedDensity), 0.0f);
+		}
 
 		Params->VelocityInput = Velocity[CurVelIdx];
 		Params->DensityInput = Density[CurDenIdx];
-		Params->DensityOutput = GraphBuilder.CreateUAV(Density[NextDenIdx]);
+		Params->DensityOutput = GraphBuilder.CreateUAV(PredictedDensity);
 		Params->BilinearSampler =
 			TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
 		Params->DeltaTime = DeltaTime;
 		Params->InvResolution = InvResolution;
 		Params->Resolution = ResolutionPt;
 
-		FComputeShaderUtils::AddPass(
+		FluidSimulationComponent::AddTiledPass<FFluidAdvectCS>(
 			GraphBuilder,
 			RDG_EVENT_NAME("VFF_Fluid.AdvectDensity"),
-			Shader,
-			Params,
-			GroupCount);
+			TileDispatch,
+			Params);
+		
+		if (bMacCormack)
+		{
+			auto* CorrectParams = GraphBuilder.AllocParameters<
+				FFluidMacCormackCS::FParameters>();
+			
+			CorrectParams->VelocityInput = Velocity[CurVelIdx];
+			CorrectParams->SourceInput = Density[CurDenIdx];
+			CorrectParams->PredictedInput = PredictedDensity;
+			CorrectParams->Output = GraphBuilder.CreateUAV(Density[NextDenIdx]);
+			CorrectParams->BilinearSampler =
+				TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+			CorrectParams->DeltaTime = DeltaTime;
+			CorrectParams->InvResolution = InvResolution;
+			CorrectParams->Resolution = ResolutionPt;
+			
+			FluidSimulationComponent::AddTiledPass<FFluidMacCormackCS>(
+				GraphBuilder,
+				RDG_EVENT_NAME("VFF_Fluid.AdvectDensityMacCormack"),
+				TileDispatch,
+				CorrectParams);
+		}
 
 		CurDenIdx = NextDenIdx;
 	}
 	
 	// Density maintenance
-	if (bInEnableDensityMaintenance && InBaseDensityNoiseTexture)
+	if (SimParams.bEnableDensityMaintenance && SimParams.BaseDensityNoiseTexture)
 	{
 		const int32 NextDenIdx = 1 - CurDenIdx;
 
@@ -1015,13 +1781,13 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 			TStaticSamplerState<SF_Bilinear, AM_Mirror, AM_Mirror, AM_Clamp>::GetRHI();
 
 		Params->DeltaTime = DeltaTime;
-		Params->BaseDensityTarget = FMath::Max(InBaseDensityTarget, 0.0f);
+		Params->BaseDensityTarget = FMath::Max(SimParams.BaseDensityTarget, 0.0f);
 		Params->BaseDensityRecoverySpeed =
-			FMath::Max(InBaseDensityRecoverySpeed, 0.0f);
+			FMath::Max(SimParams.BaseDensityRecoverySpeed, 0.0f);
 		Params->BaseDensityDeadbandRatio =
-			FMath::Clamp(InBaseDensityDeadbandRatio, 0.0f, 1.0f);
+			FMath::Clamp(SimParams.BaseDensityDeadbandRatio, 0.0f, 1.0f);
 		Params->BaseDensityNoiseRepeat =
-			FMath::Max(InBaseDensityNoiseRepeat, 0.1f);
+			FMath::Max(SimParams.BaseDensityNoiseRepeat, 0.1f);
 
 		const bool bInitializeBaseDensity =
 			!FluidResources->bBaseDensityInitialized;
@@ -1047,37 +1813,558 @@ void UFluidSimulationComponent::AddSimulationPasses(FRDGBuilder& GraphBuilder,
 		CurDenIdx = NextDenIdx;
 	}
   
+	// 중간 substep 결과는 렌더링 / Gameplay query에서 쓰지 않음
+	if (SimParams.bFinalSubstep)
+	{
+		// Gameplay query용 Density Readback (ring이 차 있으면 이번 프레임은 건너뜀)
+		if (SimParams.bDensityReadback && FluidResources->DensitySnapshot.IsValid()
+			&& FluidResources->DensityReadbackPendingCount < FFluidResources::NumDensityReadbacks)
+		{
+			AddDensityReadbackPass(GraphBuilder, FluidResources, SimParams, Density[CurDenIdx]);
+		}
+		
+		// Fog Ray March의 Empty Space Skipping용 최대값 Mip
+		if (SimParams.bDensityMaxMip)
+		{
+			AddDensityMaxMipPasses(GraphBuilder, FluidResources, SimParams, Density[CurDenIdx], DensityHistory);
+		}
+		else
+		{
+			FluidResources->DensityMaxMipPooledRT.SafeRelease();
+		}
+	}
+  
 	 OutVelIndex = CurVelIdx;
 	 OutDenIndex = CurDenIdx;
 	 OutPresIndex = CurPresIdx;
  
  }
   
+void UFluidSimulationComponent::AddActiveTilePasses(FRDGBuilder& GraphBuilder,
+	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources, const FFluidSimulationParams& SimParams,
+	FRDGTextureRef Velocity[2], FRDGTextureRef Density[2], FRDGTextureRef Pressure[2],
+	FRDGTextureRef Divergence, FRDGTextureRef TempVelocity,
+	int32 InVelIndex, int32 InDenIndex, FRDGBufferSRVRef ForceTileSourceOffsets,
+	FRDGBufferSRVRef& OutActiveTileList, FRDGBufferRef& OutActiveTileArgs)
+{
+	RDG_EVENT_SCOPE(GraphBuilder, "VFF_Fluid.ActiveTiles");
+	
+	const int32 Resolution = FluidResources->Resolution;
+	const int32 NumTiles = FMath::DivideAndRoundUp(Resolution, FluidActiveTiles::TileSize);
+	const FIntPoint NumTilesPt(NumTiles, NumTiles);
+	
+	FRDGTextureRef PrevTileMask = GraphBuilder.RegisterExternalTexture(
+		FluidResources->TileMaskPooledRT,
+		TEXT("FluidTileMask"),
+		ERDGTextureFlags::MultiFrame);
+	
+	// 처음이거나 dense 프레임 이후: 모든 tile을 이전에 활성이었던 것으로 간주해 비활성 tile을 0으로 정리
+	if (!FluidResources->bTileMaskValid)
+	{
+		AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(PrevTileMask), 1u);
+		FluidResources->bTileMaskValid = true;
+	}
+	
+	FRDGTextureRef TileMask = GraphBuilder.CreateTexture(PrevTileMask->Desc, TEXT("FluidTileMaskCurrent"));
+	
+	// Classify
+	{
+		TShaderMapRef<FFluidTileClassifyCS> Shader(
+			GetGlobalShaderMap(GMaxRHIFeatureLevel));
+		
+		auto* Params = GraphBuilder.AllocParameters<
+			FFluidTileClassifyCS::FParameters>();
+		
+		Params->DensityInput = Density[InDenIndex];
+		Params->VelocityInput = Velocity[InVelIndex];
+		Params->TileMaskOutput = GraphBuilder.CreateUAV(TileMask);
+		Params->DensityThreshold = SimParams.ActiveTileDensityThreshold;
+		Params->VelocityThresholdSquared = FMath::Square(SimParams.ActiveTileVelocityThreshold);
+		
+		Params->ForceTileSourceOffsets = ForceTileSourceOffsets;
+		Params->Resolution = FIntPoint(Resolution, Resolution);
+		
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("VFF_Fluid.TileClassify"),
+			Shader,
+			Params,
+			FIntVector(NumTiles, NumTiles, 1));
+	}
+	
+	// Compact
+	FRDGBufferRef ActiveTileList = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumTiles * NumTiles),
+		TEXT("FluidActiveTileList"));
+	FRDGBufferRef RetiredTileList = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateStructuredDesc(sizeof(uint32), NumTiles * NumTiles),
+		TEXT("FluidRetiredTileList"));
+	FRDGBufferRef ActiveTileArgs = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateIndirectDesc<FRHIDispatchIndirectParameters>(1),
+		TEXT("FluidActiveTileArgs"));
+	FRDGBufferRef RetiredTileArgs = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateIndirectDesc<FRHIDispatchIndirectParameters>(1),
+		TEXT("FluidRetiredTileArgs"));
+	
+	FRDGBufferUAVRef ActiveTileArgsUAV = GraphBuilder.CreateUAV(ActiveTileArgs, PF_R32_UINT);
+	FRDGBufferUAVRef RetiredTileArgsUAV = GraphBuilder.CreateUAV(RetiredTileArgs, PF_R32_UINT);
+	
+	// Group 수(X)는 InterlockedAdd로 누적
+	AddClearUAVPass(GraphBuilder, ActiveTileArgsUAV, 0u);
+	AddClearUAVPass(GraphBuilder, RetiredTileArgsUAV, 0u);
+	
+	{
+		TShaderMapRef<FFluidTileCompactCS> Shader(
+			GetGlobalShaderMap(GMaxRHIFeatureLevel));
+		
+		auto* Params = GraphBuilder.AllocParameters<
+			FFluidTileCompactCS::FParameters>();
+		
+		Params->TileMaskInput = TileMask;
+		Params->PrevTileMask = GraphBuilder.CreateUAV(PrevTileMask);
+		Params->ActiveTileListOutput = GraphBuilder.CreateUAV(ActiveTileList);
+		Params->ActiveTileArgs = ActiveTileArgsUAV;
+		Params->RetiredTileListOutput = GraphBuilder.CreateUAV(RetiredTileList);
+		Params->RetiredTileArgs = RetiredTileArgsUAV;
+		Params->NumTiles = NumTilesPt;
+		Params->Dilation = SimParams.ActiveTileDilation;
+		
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("VFF_Fluid.TileCompact"),
+			Shader,
+			Params,
+			FComputeShaderUtils::GetGroupCount(NumTilesPt, 8));
+	}
+	
+	// Retired tile 정리 (비활성 tile은 항상 0 -> 인접 활성 tile이 경계값으로 읽음)
+	{
+		TShaderMapRef<FFluidTileClearCS> Shader(
+			GetGlobalShaderMap(GMaxRHIFeatureLevel));
+		
+		auto* Params = GraphBuilder.AllocParameters<
+			FFluidTileClearCS::FParameters>();
+		
+		Params->Velocity0 = GraphBuilder.CreateUAV(Velocity[0]);
+		Params->Velocity1 = GraphBuilder.CreateUAV(Velocity[1]);
+		Params->TempVelocity = GraphBuilder.CreateUAV(TempVelocity);
+		Params->Density0 = GraphBuilder.CreateUAV(Density[0]);
+		Params->Density1 = GraphBuilder.CreateUAV(Density[1]);
+		Params->Pressure0 = GraphBuilder.CreateUAV(Pressure[0]);
+		Params->Pressure1 = GraphBuilder.CreateUAV(Pressure[1]);
+		Params->Divergence = GraphBuilder.CreateUAV(Divergence);
+		Params->Resolution = FIntPoint(Resolution, Resolution);
+		Params->Tiles.ActiveTileList = GraphBuilder.CreateSRV(RetiredTileList);
+		Params->Tiles.ActiveTileIndirectArgs = RetiredTileArgs;
+		
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("VFF_Fluid.TileClear"),
+			Shader,
+			Params,
+			RetiredTileArgs,
+			0);
+	}
+	
+	OutActiveTileList = GraphBuilder.CreateSRV(ActiveTileList);
+	OutActiveTileArgs = ActiveTileArgs;
+}
+
+void UFluidSimulationComponent::AddDensityReadbackPass(FRDGBuilder& GraphBuilder,
+	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources, const FFluidSimulationParams& SimParams,
+	FRDGTextureRef Density)
+{
+	const int32 Resolution = FluidResources->Resolution;
+	const int32 DownsampleFactor = FMath::Max(SimParams.DensityReadbackDownsample, 1);
+	const int32 ReadbackResolution = FMath::DivideAndRoundUp(Resolution, DownsampleFactor);
+	
+	FRDGTextureRef ReadbackTexture = Density;
+	
+	// PollDensityReadback은 PF_R32_FLOAT만 읽으므로 16-bit Density는 factor 1이어도 변환 pass를 거침
+	if (DownsampleFactor > 1 || Density->Desc.Format != PF_R32_FLOAT)
+	{
+		ReadbackTexture = GraphBuilder.CreateTexture(
+			FRDGTextureDesc::Create2D(
+				FIntPoint(ReadbackResolution, ReadbackResolution),
+				PF_R32_FLOAT,
+				FClearValueBinding::None,
+				TexCreate_ShaderResource | TexCreate_UAV),
+			TEXT("FluidDensityReadback"));
+		
+		TShaderMapRef<FFluidDensityDownsampleCS> Shader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+		
+		auto* Params = GraphBuilder.AllocParameters<FFluidDensityDownsampleCS::FParameters>();
+		Params->DensityInput = Density;
+		Params->DensityOutput = GraphBuilder.CreateUAV(ReadbackTexture);
+		Params->DownsampleFactor = static_cast<uint32>(DownsampleFactor);
+		Params->InputResolution = FIntPoint(Resolution, Resolution);
+		Params->OutputResolution = FIntPoint(ReadbackResolution, ReadbackResolution);
+		
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("VFF_Fluid.DensityDownsample"),
+			Shader,
+			Params,
+			FComputeShaderUtils::GetGroupCount(FIntPoint(ReadbackResolution, ReadbackResolution), 8));
+	}
+	
+	const int32 WriteIndex = FluidResources->DensityReadbackWriteIndex;
+	
+	FFluidResources::FDensityReadbackRequest& Request = FluidResources->DensityReadbackRequests[WriteIndex];
+	Request.Resolution = ReadbackResolution;
+	Request.BoundsOrigin = SimParams.SimulationBoundsOrigin;
+	Request.BoundsExtent = SimParams.SimulationBoundsExtent;
+	
+	AddEnqueueCopyPass(GraphBuilder, FluidResources->DensityReadbacks[WriteIndex].Get(), ReadbackTexture);
+	
+	FluidResources->DensityReadbackWriteIndex = (WriteIndex + 1) % FFluidResources::NumDensityReadbacks;
+	++FluidResources->DensityReadbackPendingCount;
+}
+
+void UFluidSimulationComponent::AddDensityMaxMipPasses(FRDGBuilder& GraphBuilder,
+	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources, const FFluidSimulationParams& SimParams,
+	FRDGTextureRef Density, FRDGTextureRef DensityHistory)
+{
+	const int32 Resolution = FluidResources->Resolution;
+	
+	// Mip 0은 2의 거듭제곱 (상위 Mip이 정확히 2x2를 덮도록)
+	const int32 BaseSize = FMath::RoundUpToPowerOfTwo(FMath::DivideAndRoundUp(Resolution, FMath::Max(SimParams.DensityMaxMipCellSize, 1)));
+	const int32 NumMips = FMath::FloorLog2(BaseSize) + 1;
+	
+	const FRDGTextureDesc Desc = FRDGTextureDesc::Create2D(
+		FIntPoint(BaseSize, BaseSize),
+		PF_R32_FLOAT,
+		FClearValueBinding::None,
+		TexCreate_ShaderResource | TexCreate_UAV,
+		NumMips);
+	
+	FRDGTextureRef MaxMip;
+	TRefCountPtr<IPooledRenderTarget>& PooledRT = FluidResources->DensityMaxMipPooledRT;
+	if (PooledRT.IsValid() && PooledRT->GetDesc().Extent == Desc.Extent)
+	{
+		MaxMip = GraphBuilder.RegisterExternalTexture(PooledRT, TEXT("FluidDensityMaxMip"));
+	}
+	else
+	{
+		MaxMip = GraphBuilder.CreateTexture(Desc, TEXT("FluidDensityMaxMip"));
+		PooledRT = GraphBuilder.ConvertToExternalTexture(MaxMip);
+	}
+	
+	TShaderMapRef<FFluidDensityMaxMipCS> Shader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	
+	FIntPoint InputResolution(Resolution, Resolution);
+	for (int32 Mip = 0; Mip < NumMips; ++Mip)
+	{
+		const FIntPoint OutputResolution(BaseSize >> Mip, BaseSize >> Mip);
+		
+		auto* Params = GraphBuilder.AllocParameters<FFluidDensityMaxMipCS::FParameters>();
+		Params->MaxMipInput = Mip == 0
+			? GraphBuilder.CreateSRV(FRDGTextureSRVDesc(Density))
+			: GraphBuilder.CreateSRV(FRDGTextureSRVDesc::CreateForMipLevel(MaxMip, Mip - 1));
+		// 보간 중이면 Mip 0은 두 Density의 최대값 (사용하지 않을 때는 입력을 그대로 bind)
+		Params->MaxMipHistoryInput = Mip == 0 && DensityHistory
+			? GraphBuilder.CreateSRV(FRDGTextureSRVDesc(DensityHistory))
+			: Params->MaxMipInput;
+		Params->bWithHistory = Mip == 0 && DensityHistory ? 1u : 0u;
+		Params->MaxMipOutput = GraphBuilder.CreateUAV(FRDGTextureUAVDesc(MaxMip, Mip));
+		Params->InputResolution = InputResolution;
+		Params->OutputResolution = OutputResolution;
+		Params->bFromDensity = Mip == 0 ? 1u : 0u;
+		
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("VFF_Fluid.DensityMaxMip %d (%dx%d)", Mip, OutputResolution.X, OutputResolution.Y),
+			Shader,
+			Params,
+			FComputeShaderUtils::GetGroupCount(OutputResolution, 8));
+		
+		InputResolution = OutputResolution;
+	}
+}
+
+void UFluidSimulationComponent::AddPressureResidualReadbackPass(FRDGBuilder& GraphBuilder,
+	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources, FRDGTextureRef Pressure,
+	FRDGTextureRef Divergence, int32 Resolution)
+{
+	const float Dx = 1.0f / static_cast<float>(Resolution);
+	const FIntPoint ResolutionPt(Resolution, Resolution);
+	const FIntVector GroupCount(
+		FMath::DivideAndRoundUp(Resolution, 8),
+		FMath::DivideAndRoundUp(Resolution, 8),
+		1);
+	
+	FRDGTextureDesc ResidualDesc = Pressure->Desc;
+	ResidualDesc.Format = PF_R32_FLOAT;
+	FRDGTextureRef Residual = GraphBuilder.CreateTexture(ResidualDesc, TEXT("FluidPressureResidual"));
+	
+	// [0] = max|r|, [1] = max|b| (양수 float은 uint 비교 순서가 같으므로 InterlockedMax 사용)
+	FRDGBufferRef ResidualMax = GraphBuilder.CreateBuffer(
+		FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), 2),
+		TEXT("FluidPressureResidualMax"));
+	FRDGBufferUAVRef ResidualMaxUAV = GraphBuilder.CreateUAV(ResidualMax, PF_R32_UINT);
+	AddClearUAVPass(GraphBuilder, ResidualMaxUAV, 0u);
+	
+	{
+		TShaderMapRef<FFluidPressureResidualCS> Shader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+		
+		auto* Params = GraphBuilder.AllocParameters<FFluidPressureResidualCS::FParameters>();
+		Params->PressureInput = Pressure;
+		Params->RhsInput = Divergence;
+		Params->ResidualOutput = GraphBuilder.CreateUAV(Residual);
+		Params->InvDxSquared = 1.0f / (Dx * Dx);
+		Params->Resolution = ResolutionPt;
+		
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("VFF_Fluid.PressureResidual"),
+			Shader,
+			Params,
+			GroupCount);
+	}
+	{
+		TShaderMapRef<FFluidPressureResidualReduceCS> Shader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+		
+		auto* Params = GraphBuilder.AllocParameters<FFluidPressureResidualReduceCS::FParameters>();
+		Params->ResidualInput = Residual;
+		Params->RhsInput = Divergence;
+		Params->ResidualMaxOutput = ResidualMaxUAV;
+		Params->Resolution = ResolutionPt;
+		
+		FComputeShaderUtils::AddPass(
+			GraphBuilder,
+			RDG_EVENT_NAME("VFF_Fluid.PressureResidualReduce"),
+			Shader,
+			Params,
+			GroupCount);
+	}
+	
+	FRHIGPUBufferReadback* Readback = FluidResources->PressureResidualReadbacks[FluidResources->PressureResidualWriteIndex].Get();
+	AddEnqueueCopyPass(GraphBuilder, Readback, ResidualMax, 2 * sizeof(uint32));
+	
+	FluidResources->PressureResidualWriteIndex = (FluidResources->PressureResidualWriteIndex + 1) % FFluidResources::NumPressureResidualReadbacks;
+	++FluidResources->PressureResidualPendingCount;
+}
+
+void UFluidSimulationComponent::AddPressureMultigridPasses(FRDGBuilder& GraphBuilder, FRDGTextureRef Pressure[2],
+	int32& CurPresIdx, FRDGTextureRef Divergence, int32 Resolution, int32 NumVCycles, int32 NumSmoothIterations)
+{
+	/** Level 0 = 시뮬레이션 해상도, 이후 level마다 절반 (FluidMultigrid 설정은 CPU Reference와 공유) */
+	using namespace FluidMultigrid;
+	
+	struct FMultigridLevel
+	{
+		FRDGTextureRef Pressure[2] = { nullptr, nullptr };
+		FRDGTextureRef Rhs = nullptr;
+		FRDGTextureRef Residual = nullptr;
+		int32 Cur = 0;
+		int32 Resolution = 0;
+		float Dx = 0.0f;
+	};
+	
+	TArray<FMultigridLevel, TInlineAllocator<MaxLevels>> Levels;
+	{
+		FMultigridLevel& Fine = Levels.AddDefaulted_GetRef();
+		Fine.Pressure[0] = Pressure[0];
+		Fine.Pressure[1] = Pressure[1];
+		Fine.Cur = CurPresIdx;
+		Fine.Rhs = Divergence;
+		Fine.Resolution = Resolution;
+		Fine.Dx = 1.0f / static_cast<float>(Resolution);
+	}
+	
+	// Coarse level의 correction은 값이 작아 Pressure 정밀도와 관계없이 32-bit
+	const EPixelFormat Format = PF_R32_FLOAT;
+	
+	while (Levels.Num() < MaxLevels && Levels.Last().Resolution > MinResolution)
+	{
+		const FMultigridLevel& Finer = Levels.Last();
+		const int32 CoarseRes = FMath::DivideAndRoundUp(Finer.Resolution, 2);
+		const float CoarseDx = Finer.Dx * 2.0f;
+		
+		const FRDGTextureDesc Desc = FRDGTextureDesc::Create2D(
+			FIntPoint(CoarseRes, CoarseRes),
+			Format,
+			FClearValueBinding::Black,
+			TexCreate_ShaderResource | TexCreate_UAV);
+		
+		FMultigridLevel& Coarse = Levels.AddDefaulted_GetRef();
+		Coarse.Pressure[0] = GraphBuilder.CreateTexture(Desc, TEXT("FluidMGPressureA"));
+		Coarse.Pressure[1] = GraphBuilder.CreateTexture(Desc, TEXT("FluidMGPressureB"));
+		Coarse.Rhs = GraphBuilder.CreateTexture(Desc, TEXT("FluidMGRhs"));
+		Coarse.Resolution = CoarseRes;
+		Coarse.Dx = CoarseDx;
+	}
+	
+	// Residual은 restriction에만 쓰이므로 가장 coarse한 level에는 필요 없음
+	for (int32 LevelIndex = 0; LevelIndex < Levels.Num() - 1; ++LevelIndex)
+	{
+		FMultigridLevel& Level = Levels[LevelIndex];
+		const FRDGTextureDesc Desc = FRDGTextureDesc::Create2D(
+			FIntPoint(Level.Resolution, Level.Resolution),
+			Format,
+			FClearValueBinding::Black,
+			TexCreate_ShaderResource | TexCreate_UAV);
+		Level.Residual = GraphBuilder.CreateTexture(Desc, TEXT("FluidMGResidual"));
+	}
+	
+	TShaderMapRef<FFluidPressureSmoothCS> SmoothShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	TShaderMapRef<FFluidPressureResidualCS> ResidualShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	TShaderMapRef<FFluidPressureRestrictCS> RestrictShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	TShaderMapRef<FFluidPressureProlongateCS> ProlongateShader(GetGlobalShaderMap(GMaxRHIFeatureLevel));
+	
+	auto GetGroupCount = [](int32 LevelResolution)
+	{
+		return FIntVector(
+			FMath::DivideAndRoundUp(LevelResolution, 8),
+			FMath::DivideAndRoundUp(LevelResolution, 8),
+			1);
+	};
+	
+	auto AddSmoothPasses = [&](FMultigridLevel& Level, int32 LevelIndex, int32 NumIterations)
+	{
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			const int32 Next = 1 - Level.Cur;
+			
+			auto* Params = GraphBuilder.AllocParameters<FFluidPressureSmoothCS::FParameters>();
+			Params->PressureInput = Level.Pressure[Level.Cur];
+			Params->RhsInput = Level.Rhs;
+			Params->PressureOutput = GraphBuilder.CreateUAV(Level.Pressure[Next]);
+			Params->Alpha = -(Level.Dx * Level.Dx);
+			Params->Weight = SmoothWeight;
+			Params->Resolution = FIntPoint(Level.Resolution, Level.Resolution);
+			
+			FComputeShaderUtils::AddPass(
+				GraphBuilder,
+				RDG_EVENT_NAME("VFF_Fluid.MG.Smooth L%d %d", LevelIndex, Iteration),
+				SmoothShader,
+				Params,
+				GetGroupCount(Level.Resolution));
+			
+			Level.Cur = Next;
+		}
+	};
+	
+	for (int32 Cycle = 0; Cycle < NumVCycles; ++Cycle)
+	{
+		// Coarse level의 초기 추정값은 0 (오차 방정식)
+		for (int32 LevelIndex = 1; LevelIndex < Levels.Num(); ++LevelIndex)
+		{
+			FMultigridLevel& Level = Levels[LevelIndex];
+			Level.Cur = 0;
+			AddClearUAVPass(GraphBuilder, GraphBuilder.CreateUAV(Level.Pressure[0]), FVector4f::Zero());
+		}
+		
+		// Down: pre-smooth -> residual -> restriction
+		for (int32 LevelIndex = 0; LevelIndex < Levels.Num() - 1; ++LevelIndex)
+		{
+			FMultigridLevel& Level = Levels[LevelIndex];
+			FMultigridLevel& Coarse = Levels[LevelIndex + 1];
+			
+			AddSmoothPasses(Level, LevelIndex, NumSmoothIterations);
+			
+			{
+				auto* Params = GraphBuilder.AllocParameters<FFluidPressureResidualCS::FParameters>();
+				Params->PressureInput = Level.Pressure[Level.Cur];
+				Params->RhsInput = Level.Rhs;
+				Params->ResidualOutput = GraphBuilder.CreateUAV(Level.Residual);
+				Params->InvDxSquared = 1.0f / (Level.Dx * Level.Dx);
+				Params->Resolution = FIntPoint(Level.Resolution, Level.Resolution);
+				
+				FComputeShaderUtils::AddPass(
+					GraphBuilder,
+					RDG_EVENT_NAME("VFF_Fluid.MG.Residual L%d", LevelIndex),
+					ResidualShader,
+					Params,
+					GetGroupCount(Level.Resolution));
+			}
+			{
+				auto* Params = GraphBuilder.AllocParameters<FFluidPressureRestrictCS::FParameters>();
+				Params->FineInput = Level.Residual;
+				Params->CoarseOutput = GraphBuilder.CreateUAV(Coarse.Rhs);
+				Params->FineResolution = FIntPoint(Level.Resolution, Level.Resolution);
+				Params->CoarseResolution = FIntPoint(Coarse.Resolution, Coarse.Resolution);
+				
+				FComputeShaderUtils::AddPass(
+					GraphBuilder,
+					RDG_EVENT_NAME("VFF_Fluid.MG.Restrict L%d", LevelIndex),
+					RestrictShader,
+					Params,
+					GetGroupCount(Coarse.Resolution));
+			}
+		}
+		
+		// Coarsest level: 셀 수가 적으므로 충분히 반복
+		// (coarse level을 만들 수 없는 해상도면 smoothing만 수행)
+		AddSmoothPasses(Levels.Last(), Levels.Num() - 1, Levels.Num() > 1 ? CoarsestIterations : NumSmoothIterations);
+		
+		// Up: prolongation(보정값 더하기) -> post-smooth
+		for (int32 LevelIndex = Levels.Num() - 2; LevelIndex >= 0; --LevelIndex)
+		{
+			FMultigridLevel& Level = Levels[LevelIndex];
+			const FMultigridLevel& Coarse = Levels[LevelIndex + 1];
+			
+			{
+				const int32 Next = 1 - Level.Cur;
+				
+				auto* Params = GraphBuilder.AllocParameters<FFluidPressureProlongateCS::FParameters>();
+				Params->PressureInput = Level.Pressure[Level.Cur];
+				Params->CorrectionInput = Coarse.Pressure[Coarse.Cur];
+				Params->PressureOutput = GraphBuilder.CreateUAV(Level.Pressure[Next]);
+				Params->BilinearSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+				Params->CoarseUVScale = FVector2f(1.0f / static_cast<float>(2 * Coarse.Resolution));
+				Params->Resolution = FIntPoint(Level.Resolution, Level.Resolution);
+				
+				FComputeShaderUtils::AddPass(
+					GraphBuilder,
+					RDG_EVENT_NAME("VFF_Fluid.MG.Prolongate L%d", LevelIndex),
+					ProlongateShader,
+					Params,
+					GetGroupCount(Level.Resolution));
+				
+				Level.Cur = Next;
+			}
+			
+			AddSmoothPasses(Level, LevelIndex, NumSmoothIterations);
+		}
+	}
+	
+	CurPresIdx = Levels[0].Cur;
+}
+  
 void UFluidSimulationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 	FluidResources.Reset();
 	
-	if (FogExtension.IsValid())
+	if (CPUSimulation.IsValid())
+	{
+		CPUSimulation->WaitForCompletion();
+		CPUSimulation.Reset();
+	}
+	DensitySnapshot.Reset();
+	
+	if (FogRenderProxy.IsValid())
 	{
-		TSharedPtr<FFogSceneViewExtension, ESPMode::ThreadSafe> LocalFogExtension= FogExtension; 
+		TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe> LocalFogRenderProxy = FogRenderProxy; 
 		
-		ReleaseHeightCurveFromFogExtension();
+		ReleaseHeightCurveFromFogProxy();
 		
-		ENQUEUE_RENDER_COMMAND(FDisableFogExtension)
+		ENQUEUE_RENDER_COMMAND(FDisableFogRenderProxy)
 		(
-			[LocalFogExtension](FRHICommandListImmediate& RHICmdList)
+			[LocalFogRenderProxy](FRHICommandListImmediate& RHICmdList)
 			{
-				if (LocalFogExtension.IsValid())
-				{
-					FFluidFogRenderState DisabledState;
-					DisabledState.bEnable = false;
-					LocalFogExtension->ApplyRenderState_RenderThread((DisabledState));
-				}
-				
+				FFluidFogRenderState DisabledState;
+				DisabledState.bEnable = false;
+				LocalFogRenderProxy->ApplyRenderState_RenderThread((DisabledState));
 			}	
 		);
-		FogExtension.Reset();
+		
+		if (UFluidFogSubsystem* FogSubsystem = GetWorld() ? GetWorld()->GetSubsystem<UFluidFogSubsystem>() : nullptr)
+		{
+			FogSubsystem->UnregisterFogVolume(this, FogRenderProxy);
+		}
+		FogRenderProxy.Reset();
 	}
 	
 	// 등록한 Interaction Overlapping 함수 unbinding 
@@ -1087,4 +2374,5 @@ void UFluidSimulationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason
 		InteractionBoundsComponent->OnComponentEndOverlap.RemoveDynamic(this, &UFluidSimulationComponent::HandleInteractionEndOverlap);
 		InteractionBoundsComponent.Reset();	
 	}
+	InteractionTracker.Reset();
 }
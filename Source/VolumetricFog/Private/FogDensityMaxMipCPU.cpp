@@ -0,0 +1,134 @@
+#include "FogDensityMaxMipCPU.h"
+
+namespace FogDensityMaxMipCPU
+{
+	/** FogCommon.ush WorldToSimulationUV */
+	FVector2f WorldToSimulationUV(const FFluidFogRenderState& State, const FVector2f& WorldXY)
+	{
+		const FVector2f SafeExtents(FMath::Max(State.SimulationExtents.X, 1e-3f), FMath::Max(State.SimulationExtents.Y, 1e-3f));
+		const FVector2f LocalXY = WorldXY - FVector2f(State.SimulationCenter.X, State.SimulationCenter.Y);
+		FVector2f UV = (LocalXY + SafeExtents) / (SafeExtents * 2.0f);
+		UV.Y = 1.0f - UV.Y;
+		return UV;
+	}
+}
+
+int32 FFogDensityMaxMipCPU::ComputeBaseSize(int32 Resolution, int32 CellSize)
+{
+	return FMath::RoundUpToPowerOfTwo(FMath::DivideAndRoundUp(FMath::Max(Resolution, 1), FMath::Max(CellSize, 1)));
+}
+
+void FFogDensityMaxMipCPU::Build(const FFogDensityFieldCPU& Field, int32 CellSize)
+{
+	const int32 Resolution = Field.Resolution;
+	BaseSize = ComputeBaseSize(Resolution, CellSize);
+	const int32 NumLevels = FMath::FloorLog2(BaseSize) + 1;
+
+	Levels.Reset();
+	Levels.SetNum(NumLevels);
+
+	// Mip 0: bilinear tap = floor(UV * Res - 0.5)와 +1
+	const float TexelPerCell = static_cast<float>(Resolution) / static_cast<float>(BaseSize);
+	TArray<float>& Base = Levels[0];
+	Base.SetNumZeroed(BaseSize * BaseSize);
+	for (int32 CellY = 0; CellY < BaseSize; ++CellY)
+	{
+		const int32 FirstY = FMath::Clamp(FMath::FloorToInt(CellY * TexelPerCell - 0.5f), 0, Resolution - 1);
+		const int32 LastY = FMath::Clamp(FMath::FloorToInt((CellY + 1) * TexelPerCell - 0.5f) + 1, 0, Resolution - 1);
+		for (int32 CellX = 0; CellX < BaseSize; ++CellX)
+		{
+			const int32 FirstX = FMath::Clamp(FMath::FloorToInt(CellX * TexelPerCell - 0.5f), 0, Resolution - 1);
+			const int32 LastX = FMath::Clamp(FMath::FloorToInt((CellX + 1) * TexelPerCell - 0.5f) + 1, 0, Resolution - 1);
+
+			float MaxDensity = 0.0f;
+			for (int32 Y = FirstY; Y <= LastY; ++Y)
+			{
+				for (int32 X = FirstX; X <= LastX; ++X)
+				{
+					MaxDensity = FMath::Max(MaxDensity, Field.Density[Y * Resolution + X]);
+				}
+			}
+			Base[CellY * BaseSize + CellX] = MaxDensity;
+		}
+	}
+
+	// Mip 1~: 2x2 최대값
+	for (int32 Level = 1; Level < NumLevels; ++Level)
+	{
+		const int32 Size = BaseSize >> Level;
+		const int32 FineSize = Size * 2;
+		const TArray<float>& Fine = Levels[Level - 1];
+		TArray<float>& Coarse = Levels[Level];
+		Coarse.SetNumZeroed(Size * Size);
+		for (int32 Y = 0; Y < Size; ++Y)
+		{
+			for (int32 X = 0; X < Size; ++X)
+			{
+				const int32 FineIndex = (Y * 2) * FineSize + X * 2;
+				Coarse[Y * Size + X] = FMath::Max(
+					FMath::Max(Fine[FineIndex], Fine[FineIndex + 1]),
+					FMath::Max(Fine[FineIndex + FineSize], Fine[FineIndex + FineSize + 1]));
+			}
+		}
+	}
+}
+
+float FFogDensityMaxMipCPU::GetMaxDensity(int32 Level, int32 X, int32 Y) const
+{
+	const int32 Size = BaseSize >> Level;
+	return Levels[Level][FMath::Clamp(Y, 0, Size - 1) * Size + FMath::Clamp(X, 0, Size - 1)];
+}
+
+bool FFogDensityMaxMipCPU::IsMaxDensityEmpty(const FFluidFogRenderState& State, float MaxRawDensity)
+{
+	const float MaxDensity = State.FogDebugMode == 0 ? MaxRawDensity : FFogShadowVolumeCPU::ShapeExtrudedDensity(MaxRawDensity);
+	return MaxDensity * State.FogDensityMultiplier <= 1e-6f;
+}
+
+float FFogDensityMaxMipCPU::SkipEmptyDensity(const FFluidFogRenderState& State, const FVector3f& RayOrigin, const FVector3f& RayDir,
+	float T, int32* OutNumLoads) const
+{
+	const FVector2f SafeExtents(FMath::Max(State.SimulationExtents.X, 1e-3f), FMath::Max(State.SimulationExtents.Y, 1e-3f));
+	const FVector3f P = RayOrigin + RayDir * T;
+	const FVector2f UV = FogDensityMaxMipCPU::WorldToSimulationUV(State, FVector2f(P.X, P.Y));
+	const FVector2f UVPerT = FVector2f(RayDir.X, -RayDir.Y) / (SafeExtents * 2.0f);
+
+	int32 NumLoads = 0;
+	int32 EmptyLevel = -1;
+	for (int32 Level = 0; Level < Levels.Num(); ++Level)
+	{
+		const int32 Size = BaseSize >> Level;
+		++NumLoads;
+		if (!IsMaxDensityEmpty(State, GetMaxDensity(Level, FMath::FloorToInt(UV.X * Size), FMath::FloorToInt(UV.Y * Size))))
+		{
+			break;
+		}
+		EmptyLevel = Level;
+	}
+
+	if (OutNumLoads)
+	{
+		*OutNumLoads = NumLoads;
+	}
+
+	if (EmptyLevel < 0)
+	{
+		return T;
+	}
+
+	const float Size = static_cast<float>(BaseSize >> EmptyLevel);
+	const float CellX = FMath::Clamp(FMath::FloorToFloat(UV.X * Size), 0.0f, Size - 1.0f);
+	const float CellY = FMath::Clamp(FMath::FloorToFloat(UV.Y * Size), 0.0f, Size - 1.0f);
+
+	float ExitX = 1e20f;
+	float ExitY = 1e20f;
+	if (FMath::Abs(UVPerT.X) > 1e-10f)
+	{
+		ExitX = ((CellX + (UVPerT.X > 0.0f ? 1.0f : 0.0f)) / Size - UV.X) / UVPerT.X;
+	}
+	if (FMath::Abs(UVPerT.Y) > 1e-10f)
+	{
+		ExitY = ((CellY + (UVPerT.Y > 0.0f ? 1.0f : 0.0f)) / Size - UV.Y) / UVPerT.Y;
+	}
+	return T + FMath::Max(FMath::Min(ExitX, ExitY), 0.0f);
+}
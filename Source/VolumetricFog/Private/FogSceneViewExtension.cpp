@@ -2,7 +2,7 @@
 #include "PixelShaderUtils.h"
 #include "RenderGraphBuilder.h"
 #include "RenderGraphUtils.h"
-#include "FogSceneViewExtension.h"
+#include "FogScreenBounds.h"
 #include "SceneRendering.h" 
 #include "SystemTextures.h"
 #include "ProfilingDebugging/CpuProfilerTrace.h"
@@ -10,11 +10,111 @@
 
 IMPLEMENT_GLOBAL_SHADER(FFogFullscreenPS, "/VolumetricFog/Rendering/FogFullscreen.usf", "MainPS", SF_Pixel);
 IMPLEMENT_GLOBAL_SHADER(FFogRayMarchingPS, "/VolumetricFog/Rendering/FogRayMarch.usf", "MainPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FFogTemporalCS, "/VolumetricFog/Rendering/FogTemporal.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFogUpsamplePS, "/VolumetricFog/Rendering/FogUpsample.usf", "MainPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FFogShadowVolumeCS, "/VolumetricFog/Rendering/FogShadowVolume.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFogFroxelInjectCS, "/VolumetricFog/Rendering/FogFroxel.usf", "InjectCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFogFroxelIntegrateCS, "/VolumetricFog/Rendering/FogFroxel.usf", "IntegrateCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FFogFroxelApplyPS, "/VolumetricFog/Rendering/FogFroxel.usf", "ApplyPS", SF_Pixel);
 
 DECLARE_GPU_STAT_NAMED(VFF_FogRayMarch, TEXT("VFF_FogRayMarch"));
-DECLARE_GPU_STAT_NAMED(VFF_FogRayMarchCopy, TEXT("VFF_FogRayMarchCopy"));
+DECLARE_GPU_STAT_NAMED(VFF_FogUpsample, TEXT("VFF_FogUpsample"));
+DECLARE_GPU_STAT_NAMED(VFF_FogTemporal, TEXT("VFF_FogTemporal"));
+DECLARE_GPU_STAT_NAMED(VFF_FogShadowVolume, TEXT("VFF_FogShadowVolume"));
+DECLARE_GPU_STAT_NAMED(VFF_FogFroxel, TEXT("VFF_FogFroxel"));
 
-FFogSceneViewExtension::FFogSceneViewExtension(const FAutoRegister& AutoRegister) : FSceneViewExtensionBase(AutoRegister)
+namespace FogSceneViewExtension
+{
+	void SetupDensityParameters(const FFluidFogRenderState& State, FRDGTextureRef DensityRDG, FRDGTextureRef DensityHistoryRDG,
+		FRDGTextureRef HeightCurveRDG, FRDGTextureRef DensityMaxMipRDG, FFogDensityParameters& OutParameters)
+	{
+		OutParameters.HeightCurveTexture = HeightCurveRDG;
+		OutParameters.HeightCurveSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI(); 
+		
+		OutParameters.DensityTexture  = DensityRDG;
+		OutParameters.BilinearSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp>::GetRHI();
+		
+		// 이전 step Density가 없으면 보간 없이 (DensityTexture를 그대로 bind)
+		OutParameters.DensityHistoryTexture = DensityHistoryRDG ? DensityHistoryRDG : DensityRDG;
+		OutParameters.DensityInterpolationAlpha = DensityHistoryRDG ? FMath::Clamp(State.DensityInterpolationAlpha, 0.0f, 1.0f) : 1.0f;
+		
+		OutParameters.HeightAttenuationMode = State.HeightAttenuationMode;
+		OutParameters.HeightFadeStartRatio = State.HeightFadeStartRatio;
+		OutParameters.HeightFadeStrength = State.HeightFadeStrength;
+		
+		OutParameters.FogBaseHeight        = State.FogBaseHeight;
+		OutParameters.FogMaxHeight         = State.FogMaxHeight;
+		OutParameters.HeightFalloff        = State.HeightFalloff;
+		
+		OutParameters.FogDensityMultiplier = State.FogDensityMultiplier; 
+		OutParameters.AbsorptionScale      = State.AbsorptionScale;
+		OutParameters.ScatteringScale      = State.ScatteringScale;
+		
+		OutParameters.SimulationCenter	= State.SimulationCenter;
+		OutParameters.SimulationExtents	= State.SimulationExtents;
+		
+		OutParameters.FogDebugMode = State.FogDebugMode;
+		
+		// Self Shadow   
+		OutParameters.SelfShadowLightDirection = State.SelfShadowLightDirection; 
+		OutParameters.SelfShadowDensityScale = State.SelfShadowDensityScale;
+		OutParameters.SelfShadowStepCount = State.SelfShadowStepCount;
+		OutParameters.SelfShadowMaxDistance = State.SelfShadowMaxDistance;
+		
+		// Empty Space Skipping
+		OutParameters.DensityMaxMipTexture = DensityMaxMipRDG;
+		OutParameters.DensityMaxMipLevels = 0;
+		OutParameters.DensityMaxMipBaseSize = 0;
+		if (State.bEmptySpaceSkipping && DensityMaxMipRDG->Desc.NumMips > 1)
+		{
+			OutParameters.DensityMaxMipLevels = DensityMaxMipRDG->Desc.NumMips;
+			OutParameters.DensityMaxMipBaseSize = DensityMaxMipRDG->Desc.Extent.X;
+		}
+	}
+	
+	/** Radical inverse (0~1), Froxel slice jitter */
+	float Halton(uint32 Index, uint32 Base)
+	{
+		float Result = 0.0f;
+		float InvBase = 1.0f / static_cast<float>(Base);
+		float Fraction = InvBase;
+		while (Index > 0)
+		{
+			Result += static_cast<float>(Index % Base) * Fraction;
+			Index /= Base;
+			Fraction *= InvBase;
+		}
+		return Result;
+	}
+	
+	/** Self Shadow가 결과에 영향을 주는지 (2D Simulation / Density Scale 0이면 Light Transmittance = 1) */
+	bool UseSelfShadow(const FFluidFogRenderState& State)
+	{
+		return State.FogDebugMode != 0 && State.SelfShadowDensityScale > 0.0f;
+	}
+	
+	/** FFluidFogRenderState의 mode에 맞는 Ray March Permutation */
+	FFogRayMarchingPS::FPermutationDomain GetRayMarchPermutation(const FFluidFogRenderState& State, bool bLowRes)
+	{
+		FFogRayMarchingPS::FPermutationDomain PermutationVector;
+		PermutationVector.Set<FFogRayMarchingPS::FFogLowResDim>(bLowRes);
+		PermutationVector.Set<FFogDebugModeDim>(FMath::Clamp(State.FogDebugMode, 0, 2));
+		PermutationVector.Set<FFogHeightModeDim>(FMath::Clamp(State.HeightAttenuationMode, 0, 2));
+		PermutationVector.Set<FFogSelfShadowDim>(UseSelfShadow(State));
+		PermutationVector.Set<FFogPhaseFunctionDim>(FMath::Abs(State.GOfHG) > UE_KINDA_SMALL_NUMBER);
+		return FFogRayMarchingPS::RemapPermutation(PermutationVector);
+	}
+	
+	/** Fog 합성 Blend: SceneColor = SceneColor * Transmittance(Alpha) + InScattering(RGB) */
+	FRHIBlendState* GetFogCompositeBlendState()
+	{
+		return TStaticBlendState<CW_RGB, BO_Add, BF_One, BF_SourceAlpha>::GetRHI();
+	}
+}
+
+FFogSceneViewExtension::FFogSceneViewExtension(const FAutoRegister& AutoRegister, FSceneInterface* InScene)
+	: FSceneViewExtensionBase(AutoRegister)
+	, Scene(InScene)
 {	
 	// PostOpaque 델리게이트 등록
 	IRendererModule& RendererModule = FModuleManager::GetModuleChecked<IRendererModule>("Renderer");
@@ -32,40 +132,128 @@ FFogSceneViewExtension::~FFogSceneViewExtension()
 	}
 }
 
+void FFogSceneViewExtension::AddVolume_RenderThread(const TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>& Volume)
+{
+	check(IsInRenderingThread());
+	
+	if (Volume.IsValid())
+	{
+		Volumes.AddUnique(Volume);
+		Volume->SetInFrameGraph_RenderThread(true);
+	}
+}
+
+void FFogSceneViewExtension::RemoveVolume_RenderThread(const TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>& Volume)
+{
+	check(IsInRenderingThread());
+	
+	Volumes.Remove(Volume);
+	if (Volume.IsValid())
+	{
+		Volume->SetInFrameGraph_RenderThread(false);
+	}
+}
+
+void FFogSceneViewExtension::PreRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(VFF_FFogSceneViewExtension_PreRenderViewFamily_RenderThread);
+	
+	// 이 Scene의 첫 View Family가 대기 중인 step을 기록 (나머지 View Family는 기록된 결과를 렌더)
+	if (Volumes.IsEmpty() || (Scene && InViewFamily.Scene != Scene))
+	{
+		return;
+	}
+	
+	for (const TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>& Volume : Volumes)
+	{
+		Volume->AddPendingSimulationPasses_RenderThread(GraphBuilder);
+	}
+}
+
 void FFogSceneViewExtension::RenderFog_RenderThread(FPostOpaqueRenderParameters& InParameters)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(VFF_FFogSceneViewExtension_RenderFog_RenderThread);
-
-	const FFluidFogRenderState& State = RenderState;
 	
-	if (!State.bEnable || !State.DensityTexture || !DensityPooledRT)
+	const FViewInfo& View = *InParameters.View;
+	if (Volumes.IsEmpty() || (Scene && View.Family && View.Family->Scene != Scene))
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(VFF_FFogSceneViewExtension_Need_Resource);
 		return;
 	}
 	
+	struct FVisibleFogVolume
+	{
+		FFogVolumeRenderProxy* Volume;
+		FIntRect FogRect;
+		double DistanceSquared;
+	};
+	TArray<FVisibleFogVolume, TInlineAllocator<16>> VisibleVolumes;
+	
+	const FVector ViewOrigin = View.ViewMatrices.GetViewOrigin();
+	for (const TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>& Volume : Volumes)
+	{
+		if (!Volume->IsRenderable())
+		{
+			continue;
+		}
+		
+		// Simulation Box의 화면 사각형에만 합성, 화면에 안 보이면 Pass 없음
+		const FBox Bounds = Volume->GetWorldBounds();
+		const FFogScreenBounds ScreenBounds = FFogScreenBounds::Compute(
+			View.ViewMatrices.GetViewProjectionMatrix(),
+			ViewOrigin,
+			Bounds,
+			InParameters.ViewportRect,
+			View.NearClippingDistance);
+		if (ScreenBounds.IsVisible())
+		{
+			VisibleVolumes.Add({ Volume.Get(), ScreenBounds.Rect, Bounds.ComputeSquaredDistanceToPoint(ViewOrigin) });
+		}
+	}
+	
+	if (VisibleVolumes.IsEmpty())
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(VFF_FFogSceneViewExtension_OffScreen);
+		return;
+	}
+	
+	// SceneColor * Transmittance + InScattering 합성은 순서 의존 → 먼 Volume부터 (카메라가 안에 있는 Volume은 마지막)
+	VisibleVolumes.Sort([](const FVisibleFogVolume& A, const FVisibleFogVolume& B)
+	{
+		return A.DistanceSquared > B.DistanceSquared;
+	});
+	
+	RDG_EVENT_SCOPE(*InParameters.GraphBuilder, "VFF_Fog %d/%d Volumes", VisibleVolumes.Num(), Volumes.Num());
+	
+	for (const FVisibleFogVolume& Visible : VisibleVolumes)
+	{
+		Visible.Volume->Render_RenderThread(InParameters, Visible.FogRect);
+	}
+}
+
+void FFogVolumeRenderProxy::Render_RenderThread(FPostOpaqueRenderParameters& InParameters, const FIntRect& FogRect)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(VFF_FFogVolumeRenderProxy_Render_RenderThread);
+
+	const FFluidFogRenderState& State = RenderState;
+	
 	FRDGTextureRef SceneColor = InParameters.ColorTexture;
 	FRDGTextureRef SceneDepth = InParameters.DepthTexture;
 
-	// 현재까지 그려진(PostOpaque) SceneColor, SceneDepth 를 가져온다.
-	const FScreenPassTexture SceneColorInput(SceneColor, InParameters.ViewportRect);
-	const FScreenPassTexture SceneDepthInput(SceneDepth, InParameters.ViewportRect);
-
 	FRDGBuilder& GraphBuilder = *InParameters.GraphBuilder;
 	const FViewInfo& View = *InParameters.View;
 
- 	// Create Render Target using Scene Color 
-	FScreenPassRenderTarget FogOutput =
-		FScreenPassRenderTarget::CreateFromInput(
-			GraphBuilder,
-			SceneColorInput,
-			ERenderTargetLoadAction::ENoAction,
-			TEXT("FogOutput")
-		); 
+	// 현재까지 그려진(PostOpaque) SceneDepth 를 가져온다.
+	const FScreenPassTexture SceneDepthInput(SceneDepth, InParameters.ViewportRect);
+
+	// SceneColor에 직접 Blend 합성 (중간 Target / Copy 없음)
+	const FScreenPassRenderTarget FogOutput(SceneColor, InParameters.ViewportRect, ERenderTargetLoadAction::ELoad);
 	 
-	// 캐싱된 PooledRT를 RDG에 등록
-	// DensityTexture를 RGD pass에서 샘플하려면 RDG에 external texture로 등록을 해야 된다. 
-	FRDGTextureRef DensityRDG = GraphBuilder.RegisterExternalTexture(DensityPooledRT);
+	// Simulation의 PooledRT를 RDG에 등록
+	// 같은 frame graph에서 Simulation pass가 이미 등록했으면 같은 RDG texture (pass 순서대로 transition)
+	FRDGTextureRef DensityRDG = GraphBuilder.RegisterExternalTexture(State.DensityPooledRT);
+	FRDGTextureRef DensityHistoryRDG = State.DensityHistoryPooledRT
+		? GraphBuilder.RegisterExternalTexture(State.DensityHistoryPooledRT)
+		: nullptr;
 	
 	const FRDGSystemTextures& SystemTextures = FRDGSystemTextures::Get(GraphBuilder);
  	
@@ -80,64 +268,65 @@ void FFogSceneViewExtension::RenderFog_RenderThread(FPostOpaqueRenderParameters&
 		HeightCurveRDG = SystemTextures.White;
 	}  
 	
-	// Shader Params 
-	auto* Params = GraphBuilder.AllocParameters<FFogRayMarchingPS::FParameters>();
-	Params->SceneColorTexture = SceneColor;
-	Params->SceneDepthTexture = SceneDepth;
-	Params->HeightCurveTexture = HeightCurveRDG;
-
-	Params->SceneColorSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
-	Params->SceneDepthSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
-	Params->HeightCurveSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI(); 
+	/** Simulation이 최대값 Mip을 만들지 않았으면 Skipping 없이 (1 mip Fallback) */
+	FRDGTextureRef DensityMaxMipRDG = State.DensityMaxMipPooledRT
+		? GraphBuilder.RegisterExternalTexture(State.DensityMaxMipPooledRT)
+		: SystemTextures.Black;
 	
-	Params->SceneColorViewport = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(SceneColorInput));
-	Params->SceneDepthViewport = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(SceneDepthInput));
-	Params->OutputViewport = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(FogOutput));
-
-	Params->DensityTexture  = DensityRDG;
-	Params->BilinearSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp>::GetRHI();
-
-	Params->InvViewProjectionMatrix = FMatrix44f(View.ViewMatrices.GetInvViewProjectionMatrix());
-	Params->CameraPosition = FVector3f(View.ViewMatrices.GetViewOrigin());
-
-	Params->HeightAttenuationMode = State.HeightAttenuationMode;
-	Params->HeightFadeStartRatio = State.HeightFadeStartRatio;
-	Params->HeightFadeStrength = State.HeightFadeStrength;
-
-	Params->FogBaseHeight        = State.FogBaseHeight;
-	Params->FogMaxHeight         = State.FogMaxHeight;
-	Params->HeightFalloff        = State.HeightFalloff;
-
-	Params->FogDensityMultiplier = State.FogDensityMultiplier; 
-	Params->AbsorptionScale      = State.AbsorptionScale;
-	Params->ScatteringScale      = State.ScatteringScale;
-	Params->FogColor             = State.FogColor;
-	Params->NumSteps             = State.NumSteps;
-	Params->MaxRayDistance       = State.MaxRayDistance;
- 
-	Params->SimulationCenter	= State.SimulationCenter;
-	Params->SimulationExtents	= State.SimulationExtents;
-
+	FFogDensityParameters DensityParameters;
+	FogSceneViewExtension::SetupDensityParameters(State, DensityRDG, DensityHistoryRDG, HeightCurveRDG, DensityMaxMipRDG, DensityParameters);
 	
-	Params->FogDebugMode = State.FogDebugMode;
+	/** Self Shadow: Simulation tick마다 한 번 bake한 Optical Depth volume을 lookup */
+	const bool bUseShadowVolume = State.bUseShadowVolume && FogSceneViewExtension::UseSelfShadow(State);
+	FRDGTextureRef ShadowVolumeRDG = bUseShadowVolume
+		? AddShadowVolumePass(GraphBuilder, View.GetFeatureLevel(), DensityParameters)
+		: SystemTextures.VolumetricBlack;
 	
-	// Self Shadow   
-	Params->SelfShadowLightDirection = State.SelfShadowLightDirection; 
-	Params->SelfShadowLightIntensity = State.SelfShadowLightIntensity;
-	Params->SelfShadowDensityScale = State.SelfShadowDensityScale;
-	Params->SelfShadowStepCount = State.SelfShadowStepCount;
-	Params->SelfShadowMaxDistance = State.SelfShadowMaxDistance;
+	FFogLightingParameters LightingParameters;
+	LightingParameters.FogColor = State.FogColor;
+	LightingParameters.SelfShadowLightIntensity = State.SelfShadowLightIntensity;
+	LightingParameters.ShadowVolumeTexture = ShadowVolumeRDG;
+	LightingParameters.ShadowVolumeSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+	LightingParameters.bUseShadowVolume = bUseShadowVolume ? 1 : 0;
+	LightingParameters.GOfHG = State.GOfHG;
 	
-	// Phase Function
-	Params->GOfHG = State.GOfHG;
-	 
-	// Read: Scene Color
-	// Write: FogOutput
-	Params->RenderTargets[0] = FogOutput.GetRenderTargetBinding();
+	FFogViewParameters ViewParameters;
+	ViewParameters.SceneDepthTexture = SceneDepth;
+	ViewParameters.SceneDepthSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
 	
-	TShaderMapRef<FFogRayMarchingPS> PS(GetGlobalShaderMap(View.GetFeatureLevel()));
+	ViewParameters.SceneDepthViewport = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(SceneDepthInput));
+	ViewParameters.OutputViewport = GetScreenPassTextureViewportParameters(FScreenPassTextureViewport(FogOutput));
+
+	ViewParameters.InvViewProjectionMatrix = FMatrix44f(View.ViewMatrices.GetInvViewProjectionMatrix());
+	ViewParameters.CameraPosition = FVector3f(View.ViewMatrices.GetViewOrigin());
 	
-	{ 
+	if (State.FogRenderMode == 1)
+	{
+		AddFroxelFogPasses(GraphBuilder, View, DensityParameters, LightingParameters, ViewParameters, FogOutput, FogRect);
+	}
+	else if (State.RayMarchDownsampleFactor > 1 || State.bTemporalRayMarch)
+	{
+		AddLowResRayMarchPasses(GraphBuilder, View, DensityParameters, LightingParameters, ViewParameters, FogOutput, FogRect,
+			FMath::Clamp(State.RayMarchDownsampleFactor, 1, 4));
+	}
+	else
+	{
+		// Shader Params 
+		auto* Params = GraphBuilder.AllocParameters<FFogRayMarchingPS::FParameters>();
+		Params->Density = DensityParameters;
+		Params->Lighting = LightingParameters;
+		Params->View = ViewParameters;
+		Params->NumSteps             = State.NumSteps;
+		Params->MaxRayDistance       = State.MaxRayDistance;
+		Params->bTemporalJitter = 0;
+		Params->TemporalJitterOffset = 0.0f;
+		 
+		// Write: SceneColor (Blend)
+		Params->RenderTargets[0] = FogOutput.GetRenderTargetBinding();
+		
+		const FFogRayMarchingPS::FPermutationDomain PermutationVector = FogSceneViewExtension::GetRayMarchPermutation(State, false);
+		TShaderMapRef<FFogRayMarchingPS> PS(GetGlobalShaderMap(View.GetFeatureLevel()), PermutationVector);
+		
 		RDG_EVENT_SCOPE_STAT(GraphBuilder, VFF_FogRayMarch, "VFF_FogRayMarch");
 		RDG_GPU_STAT_SCOPE(GraphBuilder, VFF_FogRayMarch);
 		
@@ -146,50 +335,338 @@ void FFogSceneViewExtension::RenderFog_RenderThread(FPostOpaqueRenderParameters&
 				 GetGlobalShaderMap(View.GetFeatureLevel()),
 					 RDG_EVENT_NAME("VFF_FogRayMarch"),
 				 PS, Params,
-			FogOutput.ViewRect);
+			FogRect,
+			FogSceneViewExtension::GetFogCompositeBlendState());
+	}
+}
+
+FRDGTextureRef FFogVolumeRenderProxy::AddShadowVolumePass(FRDGBuilder& GraphBuilder, ERHIFeatureLevel::Type FeatureLevel,
+	const FFogDensityParameters& DensityParameters)
+{
+	const FIntVector VolumeSize(
+		FMath::Clamp(RenderState.ShadowVolumeResolution.X, 4, 256),
+		FMath::Clamp(RenderState.ShadowVolumeResolution.Y, 4, 256),
+		FMath::Clamp(RenderState.ShadowVolumeResolution.Z, 4, 128));
+	
+	const bool bSizeChanged = !ShadowVolumePooledRT || ShadowVolumePooledRT->GetDesc().GetSize() != VolumeSize;
+	
+	// 같은 Simulation tick의 두 번째 View부터는 bake 결과 재사용
+	if (!bShadowVolumeDirty && !bSizeChanged)
+	{
+		return GraphBuilder.RegisterExternalTexture(ShadowVolumePooledRT);
+	}
+	
+	const FRDGTextureDesc Desc = FRDGTextureDesc::Create3D(VolumeSize, PF_R16F, FClearValueBinding::Black,
+		TexCreate_ShaderResource | TexCreate_UAV);
+	FRDGTextureRef ShadowVolume = GraphBuilder.CreateTexture(Desc, TEXT("FogShadowVolume"));
+	
+	auto* Params = GraphBuilder.AllocParameters<FFogShadowVolumeCS::FParameters>();
+	Params->Density = DensityParameters;
+	Params->RWShadowVolume = GraphBuilder.CreateUAV(ShadowVolume);
+	Params->ShadowVolumeSize = VolumeSize;
+	
+	FFogShadowVolumeCS::FPermutationDomain PermutationVector;
+	PermutationVector.Set<FFogHeightModeDim>(FMath::Clamp(RenderState.HeightAttenuationMode, 0, 2));
+	TShaderMapRef<FFogShadowVolumeCS> CS(GetGlobalShaderMap(FeatureLevel), PermutationVector);
+	
+	{
+		RDG_EVENT_SCOPE_STAT(GraphBuilder, VFF_FogShadowVolume, "VFF_FogShadowVolume");
+		RDG_GPU_STAT_SCOPE(GraphBuilder, VFF_FogShadowVolume);
 		
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("VFF_FogShadowVolume %dx%dx%d", VolumeSize.X, VolumeSize.Y, VolumeSize.Z),
+			CS, Params, FComputeShaderUtils::GetGroupCount(VolumeSize, FFogShadowVolumeCS::ThreadGroupSize));
 	}
-	FRHICopyTextureInfo CopyInfo;
 	
-	CopyInfo.SourcePosition = FIntVector(InParameters.ViewportRect.Min.X,
-		InParameters.ViewportRect.Min.Y, 0);
+	ShadowVolumePooledRT = GraphBuilder.ConvertToExternalTexture(ShadowVolume);
+	bShadowVolumeDirty = false;
+	return ShadowVolume;
+}
+
+void FFogVolumeRenderProxy::AddLowResRayMarchPasses(FRDGBuilder& GraphBuilder, const FViewInfo& View,
+	const FFogDensityParameters& DensityParameters, const FFogLightingParameters& LightingParameters,
+	const FFogViewParameters& ViewParameters, const FScreenPassRenderTarget& Output, const FIntRect& FogRect, int32 DownsampleFactor)
+{
+	const FFluidFogRenderState& State = RenderState;
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
+	
+	const FIntPoint LowResSize = FIntPoint::DivideAndRoundUp(Output.ViewRect.Size(), DownsampleFactor);
+	const FIntRect LowResRect(FIntPoint::ZeroValue, LowResSize);
+	
+	FRDGTextureRef FogLowRes = GraphBuilder.CreateTexture(
+		FRDGTextureDesc::Create2D(LowResSize, PF_FloatRGBA, FClearValueBinding::Black, TexCreate_RenderTargetable | TexCreate_ShaderResource),
+		TEXT("FogLowRes"));
+	FRDGTextureRef FogLowResDepth = GraphBuilder.CreateTexture(
+		FRDGTextureDesc::Create2D(LowResSize, PF_R32_FLOAT, FClearValueBinding::Black, TexCreate_RenderTargetable | TexCreate_ShaderResource),
+		TEXT("FogLowResDepth"));
 	
-	CopyInfo.DestPosition = CopyInfo.SourcePosition;
+	const FScreenPassTextureViewport LowResViewport(FogLowRes, LowResRect);
 	
-	CopyInfo.Size = FIntVector(InParameters.ViewportRect.Width(),
-		InParameters.ViewportRect.Height(), 1);
+	FFogRayMarchHistory* History = State.bTemporalRayMarch ? &RayMarchHistories.FindOrAdd(View.GetViewKey()) : nullptr;
 	
-	{ 
-		RDG_EVENT_SCOPE_STAT(GraphBuilder, VFF_FogRayMarchCopy, "VFF_FogRayMarchCopy");
-		RDG_GPU_STAT_SCOPE(GraphBuilder, VFF_FogRayMarchCopy);
-		AddCopyTexturePass(GraphBuilder, FogOutput.Texture,SceneColor, CopyInfo);
+	// FogRect에 해당하는 축소 해상도 영역 (+1 texel: Upsample tap)
+	// Temporal은 다음 프레임 reprojection이 영역 밖 History도 읽으므로 전체
+	FIntRect LowResDrawRect = LowResRect;
+	if (!History)
+	{
+		LowResDrawRect = FIntRect(
+			FIntPoint::DivideAndRoundDown(FogRect.Min - Output.ViewRect.Min, DownsampleFactor) - FIntPoint(1, 1),
+			FIntPoint::DivideAndRoundUp(FogRect.Max - Output.ViewRect.Min, DownsampleFactor) + FIntPoint(1, 1));
+		LowResDrawRect.Clip(LowResRect);
 	}
+	
+	// Ray March (축소 해상도)
+	{
+		auto* Params = GraphBuilder.AllocParameters<FFogRayMarchingPS::FParameters>();
+		Params->Density = DensityParameters;
+		Params->Lighting = LightingParameters;
+		Params->View = ViewParameters;
+		Params->View.OutputViewport = GetScreenPassTextureViewportParameters(LowResViewport);
+		Params->NumSteps             = State.NumSteps;
+		Params->MaxRayDistance       = State.MaxRayDistance;
+		
+		// R1 sequence (golden ratio): 픽셀별 IGN과 더해 프레임마다 다른 start offset
+		Params->bTemporalJitter = History ? 1 : 0;
+		Params->TemporalJitterOffset = History ? FMath::Frac(static_cast<float>(History->FrameIndex % 1024) * 0.61803398875f) : 0.0f;
+		
+		Params->RenderTargets[0] = FRenderTargetBinding(FogLowRes, ERenderTargetLoadAction::ENoAction);
+		Params->RenderTargets[1] = FRenderTargetBinding(FogLowResDepth, ERenderTargetLoadAction::ENoAction);
+		
+		const FFogRayMarchingPS::FPermutationDomain PermutationVector = FogSceneViewExtension::GetRayMarchPermutation(State, true);
+		TShaderMapRef<FFogRayMarchingPS> PS(ShaderMap, PermutationVector);
+		
+		RDG_EVENT_SCOPE_STAT(GraphBuilder, VFF_FogRayMarch, "VFF_FogRayMarch");
+		RDG_GPU_STAT_SCOPE(GraphBuilder, VFF_FogRayMarch);
+		
+		FPixelShaderUtils::AddFullscreenPass(GraphBuilder, ShaderMap,
+			RDG_EVENT_NAME("VFF_FogRayMarch 1/%d (%dx%d)", DownsampleFactor, LowResDrawRect.Width(), LowResDrawRect.Height()),
+			PS, Params, LowResDrawRect);
+	}
+	
+	// Temporal 누적 (결과가 다음 프레임 History)
+	FRDGTextureRef FogResolved = FogLowRes;
+	if (History)
+	{
+		const bool bHistoryValid = History->Fog.IsValid() && History->Depth.IsValid()
+			&& History->Fog->GetDesc().Extent == LowResSize;
+		const FMatrix44f ViewProjectionMatrix(View.ViewMatrices.GetViewProjectionMatrix());
+		
+		FogResolved = GraphBuilder.CreateTexture(
+			FRDGTextureDesc::Create2D(LowResSize, PF_FloatRGBA, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV),
+			TEXT("FogTemporal"));
+		
+		auto* Params = GraphBuilder.AllocParameters<FFogTemporalCS::FParameters>();
+		Params->FogTexture = FogLowRes;
+		Params->FogDepthTexture = FogLowResDepth;
+		
+		const FRDGSystemTextures& SystemTextures = FRDGSystemTextures::Get(GraphBuilder);
+		Params->HistoryFogTexture = bHistoryValid ? GraphBuilder.RegisterExternalTexture(History->Fog) : SystemTextures.Black;
+		Params->HistoryDepthTexture = bHistoryValid ? GraphBuilder.RegisterExternalTexture(History->Depth) : SystemTextures.Black;
+		Params->HistorySampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+		Params->HistoryDepthSampler = TStaticSamplerState<SF_Point, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+		
+		Params->FogSize = LowResSize;
+		Params->MaxRayDistance = State.MaxRayDistance;
+		Params->InvViewProjectionMatrix = ViewParameters.InvViewProjectionMatrix;
+		Params->CameraPosition = ViewParameters.CameraPosition;
+		Params->PrevViewProjectionMatrix = bHistoryValid ? History->ViewProjectionMatrix : ViewProjectionMatrix;
+		Params->PrevCameraPosition = bHistoryValid ? History->CameraPosition : ViewParameters.CameraPosition;
+		Params->HistoryWeight = FMath::Clamp(State.TemporalHistoryWeight, 0.0f, 0.98f);
+		Params->bHistoryValid = bHistoryValid ? 1 : 0;
+		Params->RWFogOutput = GraphBuilder.CreateUAV(FogResolved);
+		
+		TShaderMapRef<FFogTemporalCS> CS(ShaderMap);
+		
+		RDG_EVENT_SCOPE_STAT(GraphBuilder, VFF_FogTemporal, "VFF_FogTemporal");
+		RDG_GPU_STAT_SCOPE(GraphBuilder, VFF_FogTemporal);
+		
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("VFF_FogTemporal %dx%d", LowResSize.X, LowResSize.Y), CS, Params,
+			FComputeShaderUtils::GetGroupCount(LowResSize, FFogTemporalCS::ThreadGroupSize));
+		
+		History->Fog = GraphBuilder.ConvertToExternalTexture(FogResolved);
+		History->Depth = GraphBuilder.ConvertToExternalTexture(FogLowResDepth);
+		History->ViewProjectionMatrix = ViewProjectionMatrix;
+		History->CameraPosition = ViewParameters.CameraPosition;
+		++History->FrameIndex;
+	}
+	
+	// Bilateral Upsample + Blend 합성 (DownsampleFactor = 1이면 tap 하나 = 그대로 합성)
+	{
+		auto* Params = GraphBuilder.AllocParameters<FFogUpsamplePS::FParameters>();
+		Params->View = ViewParameters;
+		Params->FogLowResTexture = FogResolved;
+		Params->FogLowResDepthTexture = FogLowResDepth;
+		Params->LowResViewport = GetScreenPassTextureViewportParameters(LowResViewport);
+		Params->UpsampleDepthTolerance = FMath::Max(State.UpsampleDepthTolerance, 1e-3f);
+		Params->MaxRayDistance = State.MaxRayDistance;
+		Params->RenderTargets[0] = Output.GetRenderTargetBinding();
+		
+		TShaderMapRef<FFogUpsamplePS> PS(ShaderMap);
+		
+		RDG_EVENT_SCOPE_STAT(GraphBuilder, VFF_FogUpsample, "VFF_FogUpsample");
+		RDG_GPU_STAT_SCOPE(GraphBuilder, VFF_FogUpsample);
+		
+		FPixelShaderUtils::AddFullscreenPass(GraphBuilder, ShaderMap, RDG_EVENT_NAME("VFF_FogUpsample"), PS, Params, FogRect,
+			FogSceneViewExtension::GetFogCompositeBlendState());
+	}
+}
 
+void FFogVolumeRenderProxy::AddFroxelFogPasses(FRDGBuilder& GraphBuilder, const FViewInfo& View,
+	const FFogDensityParameters& DensityParameters, const FFogLightingParameters& LightingParameters,
+	const FFogViewParameters& ViewParameters, const FScreenPassRenderTarget& Output, const FIntRect& FogRect)
+{
+	const FFluidFogRenderState& State = RenderState;
+	const FIntVector GridSize(
+		FMath::Clamp(State.FroxelGridSize.X, 8, 512),
+		FMath::Clamp(State.FroxelGridSize.Y, 8, 512),
+		FMath::Clamp(State.FroxelGridSize.Z, 8, 256));
+	
+	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
+	const FRDGSystemTextures& SystemTextures = FRDGSystemTextures::Get(GraphBuilder);
+	
+	RDG_EVENT_SCOPE_STAT(GraphBuilder, VFF_FogFroxel, "VFF_FogFroxel %dx%dx%d", GridSize.X, GridSize.Y, GridSize.Z);
+	RDG_GPU_STAT_SCOPE(GraphBuilder, VFF_FogFroxel);
+	
+	FFogFroxelHistory& History = FroxelHistories.FindOrAdd(View.GetViewKey());
+	const bool bHistoryValid = History.Scattering.IsValid() && History.Scattering->GetDesc().GetSize() == GridSize;
+	
+	const FMatrix44f ViewProjectionMatrix(View.ViewMatrices.GetViewProjectionMatrix());
+	
+	// Inject (+ Temporal Reprojection)
+	const FRDGTextureDesc FroxelDesc = FRDGTextureDesc::Create3D(GridSize, PF_FloatRGBA, FClearValueBinding::Black,
+		TexCreate_ShaderResource | TexCreate_UAV);
+	FRDGTextureRef FroxelScattering = GraphBuilder.CreateTexture(FroxelDesc, TEXT("FogFroxelScattering"));
+	{
+		auto* Params = GraphBuilder.AllocParameters<FFogFroxelInjectCS::FParameters>();
+		Params->Density = DensityParameters;
+		Params->Lighting = LightingParameters;
+		Params->InvViewProjectionMatrix = ViewParameters.InvViewProjectionMatrix;
+		Params->CameraPosition = ViewParameters.CameraPosition;
+		Params->FroxelGridSize = GridSize;
+		Params->MaxRayDistance = State.MaxRayDistance;
+		
+		Params->PrevViewProjectionMatrix = bHistoryValid ? History.ViewProjectionMatrix : ViewProjectionMatrix;
+		Params->PrevCameraPosition = bHistoryValid ? History.CameraPosition : ViewParameters.CameraPosition;
+		Params->HistoryTexture = bHistoryValid ? GraphBuilder.RegisterExternalTexture(History.Scattering) : SystemTextures.VolumetricBlack;
+		Params->HistorySampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+		Params->HistoryWeight = FMath::Clamp(State.FroxelHistoryWeight, 0.0f, 0.98f);
+		Params->bHistoryValid = bHistoryValid ? 1 : 0;
+		Params->FroxelJitter = FogSceneViewExtension::Halton(History.FrameIndex % 16 + 1, 2);
+		
+		Params->RWFroxelScattering = GraphBuilder.CreateUAV(FroxelScattering);
+		
+		TShaderMapRef<FFogFroxelInjectCS> CS(ShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("VFF_FogFroxelInject"), CS, Params,
+			FComputeShaderUtils::GetGroupCount(GridSize, FFogFroxelInjectCS::ThreadGroupSize));
+	}
+	
+	// Integrate
+	FRDGTextureRef IntegratedFroxel = GraphBuilder.CreateTexture(FroxelDesc, TEXT("FogFroxelIntegrated"));
+	{
+		auto* Params = GraphBuilder.AllocParameters<FFogFroxelIntegrateCS::FParameters>();
+		Params->FroxelGridSize = GridSize;
+		Params->MaxRayDistance = State.MaxRayDistance;
+		Params->FroxelScattering = FroxelScattering;
+		Params->RWIntegratedFroxel = GraphBuilder.CreateUAV(IntegratedFroxel);
+		
+		TShaderMapRef<FFogFroxelIntegrateCS> CS(ShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder, RDG_EVENT_NAME("VFF_FogFroxelIntegrate"), CS, Params,
+			FComputeShaderUtils::GetGroupCount(FIntPoint(GridSize.X, GridSize.Y), FFogFroxelIntegrateCS::ThreadGroupSize));
+	}
+	
+	// Apply
+	{
+		auto* Params = GraphBuilder.AllocParameters<FFogFroxelApplyPS::FParameters>();
+		Params->View = ViewParameters;
+		Params->FroxelGridSize = GridSize;
+		Params->MaxRayDistance = State.MaxRayDistance;
+		Params->IntegratedFroxel = IntegratedFroxel;
+		Params->IntegratedFroxelSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp, AM_Clamp>::GetRHI();
+		Params->RenderTargets[0] = Output.GetRenderTargetBinding();
+		
+		TShaderMapRef<FFogFroxelApplyPS> PS(ShaderMap);
+		FPixelShaderUtils::AddFullscreenPass(GraphBuilder, ShaderMap, RDG_EVENT_NAME("VFF_FogFroxelApply"), PS, Params, FogRect,
+			FogSceneViewExtension::GetFogCompositeBlendState());
+	}
+	
+	// 다음 프레임 History
+	History.Scattering = GraphBuilder.ConvertToExternalTexture(FroxelScattering);
+	History.ViewProjectionMatrix = ViewProjectionMatrix;
+	History.CameraPosition = ViewParameters.CameraPosition;
+	++History.FrameIndex;
 }
 
-void FFogSceneViewExtension::ApplyRenderState_RenderThread(const FFluidFogRenderState& InState)
+void FFogVolumeRenderProxy::ApplyRenderState_RenderThread(const FFluidFogRenderState& InState)
 {
 	check(IsInRenderingThread());
 	
-	const bool bDensityChanged = (RenderState.DensityTexture != InState.DensityTexture); 
- 	
 	RenderState = InState;
 	
-	if (RenderState.DensityTexture)
+	// Simulation tick마다 새 Density / Light 방향으로 다시 bake
+	bShadowVolumeDirty = true;
+	
+	if (!RenderState.DensityPooledRT)
 	{
-		if (bDensityChanged || !DensityPooledRT)
-		{
-			DensityPooledRT = CreateRenderTarget(RenderState.DensityTexture, TEXT("FogDensity"));
-		}
+		ShadowVolumePooledRT.SafeRelease();
+		FroxelHistories.Empty();
+		RayMarchHistories.Empty();
+	} 
+}
+
+void FFogVolumeRenderProxy::QueueSimulationUpdate_RenderThread(FRHICommandListImmediate& RHICmdList, FFogSimulationUpdate&& Update)
+{
+	check(IsInRenderingThread());
+	
+	// 이전 update가 아직 남아 있으면 (이 Scene을 렌더한 View Family가 없었음) 순서를 지키도록 먼저 실행
+	FlushPendingSimulation_RenderThread(RHICmdList);
+	
+	PendingSimulationUpdate = MoveTemp(Update);
+	
+	// Extension이 없으면 frame graph를 기다리지 않음
+	if (!bInFrameGraph)
+	{
+		FlushPendingSimulation_RenderThread(RHICmdList);
 	}
-	else
+}
+
+void FFogVolumeRenderProxy::FlushPendingSimulation_RenderThread(FRHICommandListImmediate& RHICmdList)
+{
+	if (!PendingSimulationUpdate)
 	{
-		DensityPooledRT.SafeRelease();
-	} 
+		return;
+	}
+	
+	FRDGBuilder GraphBuilder(RHICmdList);
+	AddPendingSimulationPasses_RenderThread(GraphBuilder);
+	GraphBuilder.Execute();
+}
+
+void FFogVolumeRenderProxy::AddPendingSimulationPasses_RenderThread(FRDGBuilder& GraphBuilder)
+{
+	check(IsInRenderingThread());
+	
+	if (!PendingSimulationUpdate)
+	{
+		return;
+	}
+	
+	FFogSimulationUpdate Update = MoveTemp(PendingSimulationUpdate);
+	PendingSimulationUpdate = nullptr;
+	Update(GraphBuilder, *this);
+}
+
+void FFogVolumeRenderProxy::SetInFrameGraph_RenderThread(bool bInInFrameGraph)
+{
+	check(IsInRenderingThread());
+	
+	bInFrameGraph = bInInFrameGraph;
+	if (!bInFrameGraph)
+	{
+		PendingSimulationUpdate = nullptr;
+	}
 }
 
-void FFogSceneViewExtension::UpdateHeightCurveLUT_RenderThread(FRHICommandListImmediate& RHICmdList,
-                                                               TConstArrayView<float> Samples)
+void FFogVolumeRenderProxy::UpdateHeightCurveLUT_RenderThread(FRHICommandListImmediate& RHICmdList,
+                                                              TConstArrayView<float> Samples)
 { 
 	// RenderThread가 아니면 assert 
 	check(IsInRenderingThread());
@@ -217,7 +694,7 @@ void FFogSceneViewExtension::UpdateHeightCurveLUT_RenderThread(FRHICommandListIm
 	HeightCurveResource->Update(RHICmdList, Samples);
 }
 
-void FFogSceneViewExtension::ReleaseHeightCurveLUT_RenderThread()
+void FFogVolumeRenderProxy::ReleaseHeightCurveLUT_RenderThread()
 {
 	check(IsInRenderingThread());
 	
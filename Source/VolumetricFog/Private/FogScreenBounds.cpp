@@ -0,0 +1,100 @@
+#include "FogScreenBounds.h"
+
+namespace FogScreenBounds
+{
+	FVector2D ClipToNDC(const FVector4& Clip)
+	{
+		return FVector2D(Clip.X / Clip.W, Clip.Y / Clip.W);
+	}
+
+	/** NDC → 픽셀 (Y 반전) */
+	FVector2D NDCToPixel(const FVector2D& NDC, const FIntRect& ViewRect)
+	{
+		return FVector2D(
+			ViewRect.Min.X + (NDC.X * 0.5 + 0.5) * ViewRect.Width(),
+			ViewRect.Min.Y + (0.5 - NDC.Y * 0.5) * ViewRect.Height());
+	}
+}
+
+FFogScreenBounds FFogScreenBounds::Compute(const FMatrix& ViewProjectionMatrix, const FVector& ViewOrigin, const FBox& Box,
+	const FIntRect& ViewRect, double NearPlaneW)
+{
+	FFogScreenBounds Bounds;
+
+	if (Box.IsInsideOrOn(ViewOrigin))
+	{
+		Bounds.Rect = ViewRect;
+		Bounds.bCameraInside = true;
+		return Bounds;
+	}
+
+	FVector4 Corners[8];
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		const FVector Position(
+			(Corner & 1) ? Box.Max.X : Box.Min.X,
+			(Corner & 2) ? Box.Max.Y : Box.Min.Y,
+			(Corner & 4) ? Box.Max.Z : Box.Min.Z);
+		Corners[Corner] = ViewProjectionMatrix.TransformFVector4(FVector4(Position, 1.0));
+	}
+
+	FVector2D MinNDC(UE_BIG_NUMBER, UE_BIG_NUMBER);
+	FVector2D MaxNDC(-UE_BIG_NUMBER, -UE_BIG_NUMBER);
+	bool bAnyInFront = false;
+	auto AddPoint = [&](const FVector4& Clip)
+	{
+		const FVector2D NDC = FogScreenBounds::ClipToNDC(Clip);
+		MinNDC = FVector2D::Min(MinNDC, NDC);
+		MaxNDC = FVector2D::Max(MaxNDC, NDC);
+		bAnyInFront = true;
+	};
+
+	// Near Plane 앞 꼭짓점 + Near Plane과 모서리의 교점 = 잘린 Box의 꼭짓점
+	for (int32 Corner = 0; Corner < 8; ++Corner)
+	{
+		const FVector4& A = Corners[Corner];
+		if (A.W >= NearPlaneW)
+		{
+			AddPoint(A);
+		}
+		else
+		{
+			Bounds.bClippedByNearPlane = true;
+		}
+
+		for (int32 Axis = 1; Axis < 8; Axis <<= 1)
+		{
+			if (Corner & Axis)
+			{
+				continue;
+			}
+			const FVector4& B = Corners[Corner | Axis];
+			if ((A.W >= NearPlaneW) != (B.W >= NearPlaneW))
+			{
+				const double T = (NearPlaneW - A.W) / (B.W - A.W);
+				AddPoint(A + (B - A) * T);
+			}
+		}
+	}
+
+	// 전부 카메라 뒤 또는 Frustum 옆
+	if (!bAnyInFront || MinNDC.X > 1.0 || MaxNDC.X < -1.0 || MinNDC.Y > 1.0 || MaxNDC.Y < -1.0)
+	{
+		Bounds.Rect = FIntRect(ViewRect.Min, ViewRect.Min);
+		return Bounds;
+	}
+
+	MinNDC = FVector2D::Max(MinNDC, FVector2D(-1.0, -1.0));
+	MaxNDC = FVector2D::Min(MaxNDC, FVector2D(1.0, 1.0));
+
+	// Y 반전: NDC Max.Y → 픽셀 Min.Y, 가장자리 1픽셀 여유
+	const FVector2D PixelMin = FogScreenBounds::NDCToPixel(FVector2D(MinNDC.X, MaxNDC.Y), ViewRect);
+	const FVector2D PixelMax = FogScreenBounds::NDCToPixel(FVector2D(MaxNDC.X, MinNDC.Y), ViewRect);
+	Bounds.Rect = FIntRect(
+		FMath::FloorToInt(PixelMin.X) - 1,
+		FMath::FloorToInt(PixelMin.Y) - 1,
+		FMath::CeilToInt(PixelMax.X) + 1,
+		FMath::CeilToInt(PixelMax.Y) + 1);
+	Bounds.Rect.Clip(ViewRect);
+	return Bounds;
+}
@@ -0,0 +1,263 @@
+#include "FogShadowVolumeCPU.h"
+
+#include "Async/ParallelFor.h"
+#include "Math/Float16.h"
+
+namespace FogShadowVolumeCPU
+{
+	/** SF_Bilinear + AM_Clamp */
+	float SampleBilinearClamp(const FFogDensityFieldCPU& Field, float U, float V)
+	{
+		const int32 Resolution = Field.Resolution;
+		const float X = U * static_cast<float>(Resolution) - 0.5f;
+		const float Y = V * static_cast<float>(Resolution) - 0.5f;
+		const float FloorX = FMath::FloorToFloat(X);
+		const float FloorY = FMath::FloorToFloat(Y);
+		const float FracX = X - FloorX;
+		const float FracY = Y - FloorY;
+
+		const int32 X0 = FMath::Clamp(static_cast<int32>(FloorX), 0, Resolution - 1);
+		const int32 Y0 = FMath::Clamp(static_cast<int32>(FloorY), 0, Resolution - 1);
+		const int32 X1 = FMath::Clamp(static_cast<int32>(FloorX) + 1, 0, Resolution - 1);
+		const int32 Y1 = FMath::Clamp(static_cast<int32>(FloorY) + 1, 0, Resolution - 1);
+
+		const float V00 = Field.Density[Y0 * Resolution + X0];
+		const float V10 = Field.Density[Y0 * Resolution + X1];
+		const float V01 = Field.Density[Y1 * Resolution + X0];
+		const float V11 = Field.Density[Y1 * Resolution + X1];
+		return FMath::Lerp(FMath::Lerp(V00, V10, FracX), FMath::Lerp(V01, V11, FracX), FracY);
+	}
+
+	float SampleHeightCurveLUT(const FFogDensityFieldCPU& Field, float U)
+	{
+		const int32 Width = Field.HeightCurve.Num();
+		if (Width == 0)
+		{
+			return 1.0f;
+		}
+
+		const float X = FMath::Clamp(U, 0.0f, 1.0f) * static_cast<float>(Width) - 0.5f;
+		const float FloorX = FMath::FloorToFloat(X);
+		const int32 X0 = FMath::Clamp(static_cast<int32>(FloorX), 0, Width - 1);
+		const int32 X1 = FMath::Clamp(static_cast<int32>(FloorX) + 1, 0, Width - 1);
+		return FMath::Lerp(Field.HeightCurve[X0], Field.HeightCurve[X1], X - FloorX);
+	}
+
+	float ComputeHeightAttenuation(const FFluidFogRenderState& State, const FFogDensityFieldCPU& Field, float WorldZ)
+	{
+		const float HeightSpan = FMath::Max(State.FogMaxHeight - State.FogBaseHeight, 1e-3f);
+		const float HeightRatio = FMath::Clamp((WorldZ - State.FogBaseHeight) / HeightSpan, 0.0f, 1.0f);
+
+		// Legacy
+		if (State.HeightAttenuationMode == 0)
+		{
+			const float Falloff = FMath::Max(State.HeightFalloff, 1e-3f);
+			const float Dz = FMath::Max(WorldZ - State.FogBaseHeight, 0.0f);
+			const float HeightFactor = FMath::Exp(-Dz / Falloff);
+			const float TopFade = FMath::Clamp((State.FogMaxHeight - WorldZ) / Falloff, 0.0f, 1.0f);
+			return FMath::Clamp(HeightFactor * TopFade, 0.0f, 1.0f);
+		}
+
+		// Curve LUT
+		if (State.HeightAttenuationMode == 2)
+		{
+			return FMath::Clamp(SampleHeightCurveLUT(Field, HeightRatio), 0.0f, 1.0f);
+		}
+
+		// Adaptive
+		const float T = FMath::Clamp((HeightRatio - State.HeightFadeStartRatio) / FMath::Max(1.0f - State.HeightFadeStartRatio, 1e-3f), 0.0f, 1.0f);
+		const float Strength = FMath::Max(State.HeightFadeStrength, 1e-3f);
+		return FMath::Pow(FMath::Clamp(1.0f - T, 0.0f, 1.0f), Strength);
+	}
+
+	/** slab method */
+	bool RayBoxIntersect(const FVector3f& RayOrigin, const FVector3f& RayDir, const FVector3f& BoxMin, const FVector3f& BoxMax,
+		float& OutEntry, float& OutExit)
+	{
+		FVector3f SafeDir = RayDir;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (FMath::Abs(SafeDir[Axis]) < 1e-6f)
+			{
+				SafeDir[Axis] = SafeDir[Axis] >= 0.0f ? 1e-6f : -1e-6f;
+			}
+		}
+
+		const FVector3f T0 = (BoxMin - RayOrigin) / SafeDir;
+		const FVector3f T1 = (BoxMax - RayOrigin) / SafeDir;
+		const FVector3f TMin = T0.ComponentMin(T1);
+		const FVector3f TMax = T0.ComponentMax(T1);
+
+		OutEntry = TMin.GetMax();
+		OutExit = TMax.GetMin();
+		return OutEntry <= OutExit;
+	}
+}
+
+float FFogShadowVolumeCPU::ShapeExtrudedDensity(float RawDensity)
+{
+	constexpr float DensityNormalize = 0.007f;
+	constexpr float Threshold = 0.01f;
+	constexpr float Softness = 0.10f;
+
+	const float Coverage = FMath::Clamp(FMath::Max(RawDensity, 0.0f) * DensityNormalize, 0.0f, 1.0f);
+	if (Coverage <= 1e-4f)
+	{
+		return 0.0f;
+	}
+	return Coverage * FMath::SmoothStep(Threshold, Threshold + Softness, Coverage);
+}
+
+float FFogShadowVolumeCPU::SampleDensity(const FFluidFogRenderState& State, const FFogDensityFieldCPU& Field, const FVector3f& WorldPos)
+{
+	using namespace FogShadowVolumeCPU;
+
+	if (Field.Resolution <= 0 || Field.Density.Num() < Field.Resolution * Field.Resolution)
+	{
+		return 0.0f;
+	}
+
+	const bool b2D = State.FogDebugMode == 0;
+
+	// 높이 제한
+	if (!b2D && (WorldPos.Z < State.FogBaseHeight || WorldPos.Z > State.FogMaxHeight))
+	{
+		return 0.0f;
+	}
+
+	// 월드 XY -> Simluate UV (Y flip)
+	const float SafeExtentX = FMath::Max(State.SimulationExtents.X, 1e-3f);
+	const float SafeExtentY = FMath::Max(State.SimulationExtents.Y, 1e-3f);
+	const float U = (WorldPos.X - State.SimulationCenter.X + SafeExtentX) / (SafeExtentX * 2.0f);
+	const float V = 1.0f - (WorldPos.Y - State.SimulationCenter.Y + SafeExtentY) / (SafeExtentY * 2.0f);
+	if (U < 0.0f || U > 1.0f || V < 0.0f || V > 1.0f)
+	{
+		return 0.0f;
+	}
+
+	const float RawDensity = SampleBilinearClamp(Field, U, V);
+	if (b2D)
+	{
+		return FMath::Max(RawDensity * State.FogDensityMultiplier, 0.0f);
+	}
+
+	// SampleExtrudedShapedDensity
+	const float Shaped = ShapeExtrudedDensity(RawDensity);
+	const float HeightMask = FMath::Clamp(ComputeHeightAttenuation(State, Field, WorldPos.Z), 0.0f, 1.0f);
+	return Shaped * HeightMask * State.FogDensityMultiplier;
+}
+
+float FFogShadowVolumeCPU::ComputeLightOpticalDepth(const FFluidFogRenderState& State, const FFogDensityFieldCPU& Field,
+	const FVector3f& WorldPos)
+{
+	// 2D Simulation
+	if (State.FogDebugMode == 0)
+	{
+		return 0.0f;
+	}
+
+	const FVector3f ToLight = State.SelfShadowLightDirection;
+	const FVector3f BoxMin = State.SimulationCenter - State.SimulationExtents;
+	const FVector3f BoxMax = State.SimulationCenter + State.SimulationExtents;
+	const FVector3f Start = WorldPos + ToLight;
+
+	float Entry, Exit;
+	if (!FogShadowVolumeCPU::RayBoxIntersect(Start, ToLight, BoxMin, BoxMax, Entry, Exit))
+	{
+		return 0.0f;
+	}
+
+	const float TStart = FMath::Max(Entry, 0.0f);
+	const float TEnd = FMath::Min(Exit, State.SelfShadowMaxDistance);
+	if (TEnd <= TStart)
+	{
+		return 0.0f;
+	}
+
+	const int32 Steps = FMath::Max(State.SelfShadowStepCount, 1);
+	const float StepSize = (TEnd - TStart) / static_cast<float>(Steps);
+	const float StepMeters = StepSize * 0.01f;
+	float T = TStart + StepSize;
+
+	float OpticalDepth = 0.0f;
+	for (int32 Step = 0; Step < Steps; ++Step)
+	{
+		const float Density = SampleDensity(State, Field, Start + ToLight * T);
+		if (Density > 1e-6f)
+		{
+			const float SigmaA = Density * FMath::Max(State.AbsorptionScale, 0.0f);
+			const float SigmaS = Density * FMath::Max(State.ScatteringScale, 0.0f);
+			const float SigmaT = FMath::Max(SigmaA + SigmaS, 1e-6f) * State.SelfShadowDensityScale;
+
+			OpticalDepth += SigmaT * StepMeters;
+			if (FMath::Exp(-OpticalDepth) < 0.1f)
+			{
+				return OpticalDepth;
+			}
+		}
+		T += StepSize;
+	}
+	return OpticalDepth;
+}
+
+void FFogShadowVolumeCPU::Bake(const FFluidFogRenderState& State, const FFogDensityFieldCPU& Field, const FIntVector& InSize)
+{
+	Size = FIntVector(FMath::Max(InSize.X, 1), FMath::Max(InSize.Y, 1), FMath::Max(InSize.Z, 1));
+	OpticalDepth.SetNumUninitialized(Size.X * Size.Y * Size.Z);
+
+	const FVector3f BoxMin = State.SimulationCenter - State.SimulationExtents;
+	const FVector3f BoxSize = State.SimulationExtents * 2.0f;
+	const FVector3f InvSize(1.0f / Size.X, 1.0f / Size.Y, 1.0f / Size.Z);
+
+	ParallelFor(Size.Y * Size.Z, [&](int32 Row)
+	{
+		const int32 Y = Row % Size.Y;
+		const int32 Z = Row / Size.Y;
+		float* Output = OpticalDepth.GetData() + Row * Size.X;
+
+		for (int32 X = 0; X < Size.X; ++X)
+		{
+			const FVector3f UVW = (FVector3f(static_cast<float>(X), static_cast<float>(Y), static_cast<float>(Z)) + 0.5f) * InvSize;
+			const FVector3f P = BoxMin + UVW * BoxSize;
+
+			// PF_R16F
+			Output[X] = FFloat16(ComputeLightOpticalDepth(State, Field, P)).GetFloat();
+		}
+	});
+}
+
+float FFogShadowVolumeCPU::SampleTransmittance(const FFluidFogRenderState& State, const FVector3f& WorldPos) const
+{
+	if (OpticalDepth.IsEmpty())
+	{
+		return 1.0f;
+	}
+
+	const FVector3f BoxMin = State.SimulationCenter - State.SimulationExtents;
+	const FVector3f BoxSize = (State.SimulationExtents * 2.0f).ComponentMax(FVector3f(1e-3f));
+	const FVector3f UVW = (WorldPos - BoxMin) / BoxSize;
+
+	// SF_Trilinear + AM_Clamp
+	int32 I0[3], I1[3];
+	float Frac[3];
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		const float Coord = FMath::Clamp(UVW[Axis], 0.0f, 1.0f) * static_cast<float>(Size[Axis]) - 0.5f;
+		const float Floor = FMath::FloorToFloat(Coord);
+		Frac[Axis] = Coord - Floor;
+		I0[Axis] = FMath::Clamp(static_cast<int32>(Floor), 0, Size[Axis] - 1);
+		I1[Axis] = FMath::Clamp(static_cast<int32>(Floor) + 1, 0, Size[Axis] - 1);
+	}
+
+	auto Fetch = [this](int32 X, int32 Y, int32 Z)
+	{
+		return OpticalDepth[(Z * Size.Y + Y) * Size.X + X];
+	};
+
+	const float C00 = FMath::Lerp(Fetch(I0[0], I0[1], I0[2]), Fetch(I1[0], I0[1], I0[2]), Frac[0]);
+	const float C10 = FMath::Lerp(Fetch(I0[0], I1[1], I0[2]), Fetch(I1[0], I1[1], I0[2]), Frac[0]);
+	const float C01 = FMath::Lerp(Fetch(I0[0], I0[1], I1[2]), Fetch(I1[0], I0[1], I1[2]), Frac[0]);
+	const float C11 = FMath::Lerp(Fetch(I0[0], I1[1], I1[2]), Fetch(I1[0], I1[1], I1[2]), Frac[0]);
+	const float Depth = FMath::Lerp(FMath::Lerp(C00, C10, Frac[1]), FMath::Lerp(C01, C11, Frac[1]), Frac[2]);
+	return FMath::Exp(-Depth);
+}
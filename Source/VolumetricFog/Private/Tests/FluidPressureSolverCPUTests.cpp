@@ -0,0 +1,214 @@
+#include "FluidPressureSolverCPU.h"
+#include "FluidSimulationComponent.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FluidPressureSolverCPUTests
+{
+	/** 부호가 섞인 Gaussian 몇 개 (Force source가 만드는 Divergence처럼 매끄러움), 합이 0이 되도록 평균을 뺌 (Neumann 경계에서 해가 존재) */
+	TArray<float> MakeDivergence(int32 Resolution, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<float> Divergence;
+		Divergence.SetNumZeroed(Resolution * Resolution);
+
+		for (int32 Blob = 0; Blob < 8; ++Blob)
+		{
+			const FVector2f Center(Random.FRand(), Random.FRand());
+			const float Radius = Random.FRandRange(0.03f, 0.12f);
+			const float Amplitude = (Random.FRand() < 0.5f ? -1.0f : 1.0f) * Resolution;
+
+			for (int32 Y = 0; Y < Resolution; ++Y)
+			{
+				for (int32 X = 0; X < Resolution; ++X)
+				{
+					const FVector2f UV((X + 0.5f) / Resolution, (Y + 0.5f) / Resolution);
+					Divergence[Y * Resolution + X] += Amplitude * FMath::Exp(-0.5f * (UV - Center).SizeSquared() / FMath::Square(Radius));
+				}
+			}
+		}
+
+		double Sum = 0.0;
+		for (const float Value : Divergence)
+		{
+			Sum += Value;
+		}
+		const float Mean = static_cast<float>(Sum / Divergence.Num());
+		for (float& Value : Divergence)
+		{
+			Value -= Mean;
+		}
+		return Divergence;
+	}
+
+	/** 균일 분포 난수 grid (Scale 배) */
+	TArray<float> MakeRandomGrid(int32 Resolution, float Scale, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<float> Grid;
+		Grid.SetNumUninitialized(Resolution * Resolution);
+		for (float& Value : Grid)
+		{
+			Value = Random.FRandRange(-Scale, Scale);
+		}
+		return Grid;
+	}
+
+	/** MultigridVCycle 한 번의 비용 (fine grid Jacobi sweep 단위, level마다 셀 수 비율로 환산) */
+	float ComputeVCycleWork(int32 Resolution, int32 NumSmoothIterations)
+	{
+		const float FineCells = static_cast<float>(Resolution * Resolution);
+		float Work = 0.0f;
+
+		int32 LevelResolution = Resolution;
+		for (int32 Level = 0; Level < FluidMultigrid::MaxLevels; ++Level)
+		{
+			const float CellRatio = static_cast<float>(LevelResolution * LevelResolution) / FineCells;
+			if (Level == FluidMultigrid::MaxLevels - 1 || LevelResolution <= FluidMultigrid::MinResolution)
+			{
+				Work += (Level > 0 ? FluidMultigrid::CoarsestIterations : NumSmoothIterations) * CellRatio;
+				break;
+			}
+
+			// Down / Up smoothing + Residual + Prolongate (Restrict는 coarse 셀 수)
+			Work += (2 * NumSmoothIterations + 2 + 0.25f) * CellRatio;
+			LevelResolution = FMath::DivideAndRoundUp(LevelResolution, 2);
+		}
+		return Work;
+	}
+
+	/** Residual이 Target(초기값 대비) 이하가 될 때까지의 sweep 수 (MaxSweeps까지 못 가면 -1) */
+	template<typename SweepFuncType>
+	int32 CountSweepsToResidual(TConstArrayView<float> Divergence, int32 Resolution, float Target, int32 MaxSweeps, SweepFuncType&& SweepFunc)
+	{
+		TArray<float> Pressure;
+		Pressure.SetNumZeroed(Resolution * Resolution);
+		const float InitialResidual = FFluidPressureSolverCPU::ComputeResidualNorm(Pressure, Divergence, Resolution);
+
+		for (int32 Sweep = 1; Sweep <= MaxSweeps; ++Sweep)
+		{
+			SweepFunc(Pressure);
+			if (FFluidPressureSolverCPU::ComputeResidualNorm(Pressure, Divergence, Resolution) <= Target * InitialResidual)
+			{
+				return Sweep;
+			}
+		}
+		return -1;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFluidPressureMultigridConvergenceTest, "VolumetricFog.PressureSolver.MultigridConvergence",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFluidPressureMultigridConvergenceTest::RunTest(const FString& Parameters)
+{
+	using namespace FluidPressureSolverCPUTests;
+
+	// FFluidSimulationParams 기본값 (MultigridVCycles = 2, MultigridSmoothIterations = 2)
+	constexpr int32 NumVCycles = 2;
+	constexpr int32 NumSmoothIterations = 2;
+
+	for (const int32 Resolution : { 64, 128 })
+	{
+		const TArray<float> Divergence = MakeDivergence(Resolution, 7);
+
+		TArray<float> Initial;
+		Initial.SetNumZeroed(Resolution * Resolution);
+		const float InitialResidual = FFluidPressureSolverCPU::ComputeResidualNorm(Initial, Divergence, Resolution);
+
+		TArray<float> Multigrid = Initial;
+		FFluidPressureSolverCPU::MultigridVCycle(Multigrid, Divergence, Resolution, NumVCycles, NumSmoothIterations);
+		const float MultigridResidual = FFluidPressureSolverCPU::ComputeResidualNorm(Multigrid, Divergence, Resolution) / InitialResidual;
+
+		// 같은 비용의 Jacobi
+		const int32 JacobiIterations = FMath::CeilToInt(NumVCycles * ComputeVCycleWork(Resolution, NumSmoothIterations));
+		TArray<float> Jacobi = Initial;
+		FFluidPressureSolverCPU::Jacobi(Jacobi, Divergence, Resolution, JacobiIterations);
+		const float JacobiResidual = FFluidPressureSolverCPU::ComputeResidualNorm(Jacobi, Divergence, Resolution) / InitialResidual;
+
+		AddInfo(FString::Printf(TEXT("%dx%d: %d V-cycles %.4f, %d Jacobi iterations %.4f (relative residual)"),
+			Resolution, Resolution, NumVCycles, MultigridResidual, JacobiIterations, JacobiResidual));
+
+		TestTrue(FString::Printf(TEXT("%dx%d V-cycle residual is finite"), Resolution, Resolution), FMath::IsFinite(MultigridResidual));
+		TestTrue(FString::Printf(TEXT("%dx%d V-cycle reduces the residual faster than Jacobi at equal work"), Resolution, Resolution),
+			MultigridResidual < 0.5f * JacobiResidual);
+
+		// 해상도와 무관한 수렴률 (cycle당 고정 비율)
+		TArray<float> MoreCycles = Initial;
+		FFluidPressureSolverCPU::MultigridVCycle(MoreCycles, Divergence, Resolution, 4, NumSmoothIterations);
+		TestTrue(FString::Printf(TEXT("%dx%d four V-cycles reduce the residual below 10%%"), Resolution, Resolution),
+			FFluidPressureSolverCPU::ComputeResidualNorm(MoreCycles, Divergence, Resolution) < 0.1f * InitialResidual);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFluidPressureRedBlackSORConvergenceTest, "VolumetricFog.PressureSolver.RedBlackSORConvergence",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFluidPressureRedBlackSORConvergenceTest::RunTest(const FString& Parameters)
+{
+	using namespace FluidPressureSolverCPUTests;
+
+	constexpr int32 Resolution = 64;
+	constexpr float TargetResidual = 0.1f;
+	constexpr int32 MaxSweeps = 4000;
+	const float Omega = FFluidSimulationParams().SOROmega;
+
+	const TArray<float> Divergence = MakeDivergence(Resolution, 7);
+
+	// SOR의 한 sweep = Red + Black (셀마다 한 번 갱신, Jacobi 한 iteration과 같은 비용)
+	const int32 SORSweeps = CountSweepsToResidual(Divergence, Resolution, TargetResidual, MaxSweeps,
+		[&](TArray<float>& Pressure) { FFluidPressureSolverCPU::RedBlackSOR(Pressure, Divergence, Resolution, 1, Omega); });
+	const int32 JacobiSweeps = CountSweepsToResidual(Divergence, Resolution, TargetResidual, MaxSweeps,
+		[&](TArray<float>& Pressure) { FFluidPressureSolverCPU::Jacobi(Pressure, Divergence, Resolution, 1); });
+
+	AddInfo(FString::Printf(TEXT("%dx%d, residual %.2f: SOR (Omega %.2f) %d sweeps, Jacobi %d sweeps"),
+		Resolution, Resolution, TargetResidual, Omega, SORSweeps, JacobiSweeps));
+
+	TestTrue(TEXT("SOR reaches the target residual"), SORSweeps > 0);
+	TestTrue(TEXT("SOR reaches the target residual in fewer sweeps than Jacobi"), JacobiSweeps < 0 || SORSweeps < JacobiSweeps);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFluidPressureFusedJacobiParityTest, "VolumetricFog.PressureSolver.FusedJacobiParity",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFluidPressureFusedJacobiParityTest::RunTest(const FString& Parameters)
+{
+	using namespace FluidPressureSolverCPUTests;
+
+	// 8x8 tile, 16의 배수가 아닌 해상도 (가장자리 tile이 잘림), iteration 수는 dispatch당 iteration의 배수가 아님
+	constexpr int32 NumIterations = 11;
+
+	for (const int32 Resolution : { 37, 50, 72 })
+	{
+		const TArray<float> Divergence = MakeRandomGrid(Resolution, static_cast<float>(Resolution), Resolution);
+		const TArray<float> InitialPressure = MakeRandomGrid(Resolution, 1.0f, Resolution + 1);
+
+		TArray<float> Reference = InitialPressure;
+		FFluidPressureSolverCPU::Jacobi(Reference, Divergence, Resolution, NumIterations);
+
+		for (int32 IterationsPerDispatch = 1; IterationsPerDispatch <= 4; ++IterationsPerDispatch)
+		{
+			TArray<float> Tiled = InitialPressure;
+			FFluidPressureSolverCPU::JacobiTiled(Tiled, Divergence, Resolution, NumIterations, IterationsPerDispatch);
+
+			int32 NumMismatches = 0;
+			for (int32 Index = 0; Index < Reference.Num(); ++Index)
+			{
+				NumMismatches += FMemory::Memcmp(&Reference[Index], &Tiled[Index], sizeof(float)) != 0 ? 1 : 0;
+			}
+
+			TestEqual(FString::Printf(TEXT("%dx%d, %d iterations per dispatch: cells that differ from Jacobi"),
+				Resolution, Resolution, IterationsPerDispatch), NumMismatches, 0);
+		}
+	}
+
+	return true;
+}
+
+#endif
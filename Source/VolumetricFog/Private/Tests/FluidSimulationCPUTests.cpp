@@ -0,0 +1,730 @@
+#include "FluidSimulationCPU.h"
+#include "FluidSimulationComponent.h"
+#include "Async/ParallelFor.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FluidSimulationCPUTests
+{
+	/** Rotating blob 한 바퀴 후 해석해(초기값) 대비 */
+	struct FRotatingBlobResult
+	{
+		/** sum|error| / sum|analytic| */
+		float RelativeL1Error = 0.0f;
+		/** 초기 peak = 1 */
+		float MaxValue = 0.0f;
+		float MinValue = 0.0f;
+	};
+
+	/** 중심 (0.5, 0.5) 기준 강체 회전 속도장에서 Gaussian blob을 NumSteps 동안 한 바퀴 advect */
+	FRotatingBlobResult RunRotatingBlob(int32 Resolution, EFluidAdvectionMode AdvectionMode, int32 NumSteps)
+	{
+		const int32 NumCells = Resolution * Resolution;
+		const float InvResolution = 1.0f / static_cast<float>(Resolution);
+
+		constexpr float AngularSpeed = UE_TWO_PI;
+		constexpr float BlobCenterU = 0.5f;
+		constexpr float BlobCenterV = 0.75f;
+		constexpr float BlobRadius = 0.08f;
+		const float DeltaTime = 1.0f / static_cast<float>(NumSteps);
+
+		TArray<float> VelocityX, VelocityY, Analytic;
+		VelocityX.SetNumUninitialized(NumCells);
+		VelocityY.SetNumUninitialized(NumCells);
+		Analytic.SetNumUninitialized(NumCells);
+
+		for (int32 Y = 0; Y < Resolution; ++Y)
+		{
+			for (int32 X = 0; X < Resolution; ++X)
+			{
+				const int32 Index = Y * Resolution + X;
+				const float U = (static_cast<float>(X) + 0.5f) * InvResolution;
+				const float V = (static_cast<float>(Y) + 0.5f) * InvResolution;
+
+				// Velocity 단위는 cell/s
+				VelocityX[Index] = -AngularSpeed * (V - 0.5f) * static_cast<float>(Resolution);
+				VelocityY[Index] = AngularSpeed * (U - 0.5f) * static_cast<float>(Resolution);
+
+				const float DistSq = FMath::Square(U - BlobCenterU) + FMath::Square(V - BlobCenterV);
+				Analytic[Index] = FMath::Exp(-0.5f * DistSq / FMath::Square(BlobRadius * 0.5f));
+			}
+		}
+
+		TArray<float> Field = Analytic;
+		TArray<float> Scratch;
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			FFluidSimulationCPU::AdvectScalarField(Field, Scratch, VelocityX, VelocityY, Resolution, DeltaTime, AdvectionMode);
+			Swap(Field, Scratch);
+		}
+
+		FRotatingBlobResult Result;
+		Result.MinValue = Field[0];
+		double AbsSum = 0.0;
+		double AnalyticSum = 0.0;
+		for (int32 Index = 0; Index < NumCells; ++Index)
+		{
+			AbsSum += FMath::Abs(static_cast<double>(Field[Index]) - Analytic[Index]);
+			AnalyticSum += Analytic[Index];
+			Result.MaxValue = FMath::Max(Result.MaxValue, Field[Index]);
+			Result.MinValue = FMath::Min(Result.MinValue, Field[Index]);
+		}
+		Result.RelativeL1Error = static_cast<float>(AbsSum / AnalyticSum);
+		return Result;
+	}
+
+	/** 기본 BaseDensityTarget 크기(500)의 Gaussian plume, 16-bit에서 1 ulp = 0.25 근처 */
+	TArray<float> MakePlumeDensity(int32 Resolution, const FVector2f& Center, float Radius)
+	{
+		const float InvResolution = 1.0f / static_cast<float>(Resolution);
+
+		TArray<float> Density;
+		Density.SetNumUninitialized(Resolution * Resolution);
+		for (int32 Y = 0; Y < Resolution; ++Y)
+		{
+			for (int32 X = 0; X < Resolution; ++X)
+			{
+				const FVector2f UV((static_cast<float>(X) + 0.5f) * InvResolution, (static_cast<float>(Y) + 0.5f) * InvResolution);
+				Density[Y * Resolution + X] = 500.0f * FMath::Exp(-0.5f * (UV - Center).SizeSquared() / FMath::Square(Radius));
+			}
+		}
+		return Density;
+	}
+
+	/** 32-bit 시뮬레이션 대비 (마지막 step) */
+	struct FPrecisionDrift
+	{
+		/** sum|error| / sum|full| */
+		float DensityRelativeL1Error = 0.0f;
+		/** 총 density (Precision / Full) */
+		float MassRatio = 1.0f;
+		/** NaN / Inf가 생기지 않았는지 */
+		bool bFinite = true;
+	};
+
+	/** 기본 BaseDensityTarget 크기의 Gaussian plume 주위를 Interaction force 하나가 도는 시나리오를 NumSteps 진행 */
+	FFluidSimulationCPU RunPlumeScenario(int32 Resolution, const FFluidSimulationPrecision& Precision,
+		EFluidPressureSolverMode PressureSolverMode, int32 NumSteps)
+	{
+		FFluidSimulationCPU Simulation;
+		Simulation.Init(Resolution);
+		Simulation.SetPrecision(Precision);
+		Simulation.SetDensity(MakePlumeDensity(Resolution, FVector2f(0.5f, 0.5f), 0.15f));
+
+		FFluidSimulationParams SimParams;
+		SimParams.DeltaTime = 1.0f / 60.0f;
+		SimParams.Dissipation = 0.999f;
+		SimParams.PressureSolverMode = PressureSolverMode;
+		SimParams.bEnableDensityMaintenance = false;
+		SimParams.InteractionForceSources.SetNum(1);
+
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			// cell/s^2
+			const float Angle = UE_TWO_PI * static_cast<float>(Step) / 240.0f;
+			FFluidInteractionForceSource& Source = SimParams.InteractionForceSources[0];
+			Source.PositionRadius = FVector4f(0.5f + 0.25f * FMath::Cos(Angle), 0.5f + 0.25f * FMath::Sin(Angle), 0.05f, 0.05f);
+			Source.ForceDensity = FVector4f(-FMath::Sin(Angle) * 4.0f * Resolution, FMath::Cos(Angle) * 4.0f * Resolution, 0.0f, 1.0f);
+
+			Simulation.Step(SimParams);
+		}
+		return Simulation;
+	}
+
+	FPrecisionDrift MeasureDrift(const FFluidSimulationCPU& Reference, const FFluidSimulationCPU& Quantized)
+	{
+		const TConstArrayView<float> ReferenceDensity = Reference.GetDensity();
+		const TConstArrayView<float> QuantizedDensity = Quantized.GetDensity();
+
+		FPrecisionDrift Drift;
+		double AbsSum = 0.0;
+		double ReferenceSum = 0.0;
+		double QuantizedSum = 0.0;
+		for (int32 Index = 0; Index < ReferenceDensity.Num(); ++Index)
+		{
+			Drift.bFinite = Drift.bFinite && FMath::IsFinite(QuantizedDensity[Index])
+				&& FMath::IsFinite(Quantized.GetVelocityX()[Index]) && FMath::IsFinite(Quantized.GetVelocityY()[Index]);
+
+			AbsSum += FMath::Abs(static_cast<double>(QuantizedDensity[Index]) - ReferenceDensity[Index]);
+			ReferenceSum += FMath::Abs(ReferenceDensity[Index]);
+			QuantizedSum += FMath::Abs(QuantizedDensity[Index]);
+		}
+
+		Drift.DensityRelativeL1Error = static_cast<float>(AbsSum / FMath::Max(ReferenceSum, UE_DOUBLE_SMALL_NUMBER));
+		Drift.MassRatio = static_cast<float>(QuantizedSum / FMath::Max(ReferenceSum, UE_DOUBLE_SMALL_NUMBER));
+		return Drift;
+	}
+
+	/** Force 방향은 임의, 크기는 Resolution (cell/s^2) */
+	FFluidInteractionForceSource MakeForceSource(FRandomStream& Random, const FVector2f& Position, float RadiusUV, float SweepLengthUV, int32 Resolution)
+	{
+		const float Angle = Random.FRandRange(0.0f, UE_TWO_PI);
+		const FVector2f Direction(FMath::Cos(Angle), FMath::Sin(Angle));
+
+		FFluidInteractionForceSource Source;
+		Source.PositionRadius = FVector4f(Position.X, Position.Y, RadiusUV, RadiusUV);
+		Source.ForceDensity = FVector4f(Direction.X, Direction.Y, 0.0f, 0.0f) * Resolution;
+		// 진행 방향 뒤쪽으로 이번 스텝의 이동 경로
+		Source.SweepOffset = FVector4f(-Direction.X, -Direction.Y, 0.0f, 0.0f) * SweepLengthUV;
+		return Source;
+	}
+
+	/** 모든 셀에서 모든 source를 평가 (bCutoff면 FluidInteractionForceBins::CutoffSquared 밖은 무시) */
+	void ApplyForcesBruteForce(const FFluidSimulationParams& SimParams, int32 Resolution, bool bCutoff, TArray<float>& OutVelocityX, TArray<float>& OutVelocityY)
+	{
+		const float InvResolution = 1.0f / static_cast<float>(Resolution);
+		OutVelocityX.SetNumZeroed(Resolution * Resolution);
+		OutVelocityY.SetNumZeroed(Resolution * Resolution);
+
+		ParallelFor(Resolution, [&](int32 Y)
+		{
+			for (int32 X = 0; X < Resolution; ++X)
+			{
+				const FVector2f UV((X + 0.5f) * InvResolution, (Y + 0.5f) * InvResolution);
+				const int32 Index = Y * Resolution + X;
+
+				// Binning과 같은 source 순서로 합산
+				for (const FFluidInteractionForceSource& Source : SimParams.InteractionForceSources)
+				{
+					const float DistanceSquared = FFluidSimulationCPU::GetForceSourceDistanceSquared(Source, UV);
+					if (!bCutoff || DistanceSquared < FluidInteractionForceBins::CutoffSquared)
+					{
+						const float Influence = FMath::Exp(-0.5f * DistanceSquared);
+						OutVelocityX[Index] += Source.ForceDensity.X * Influence * SimParams.DeltaTime;
+						OutVelocityY[Index] += Source.ForceDensity.Y * Influence * SimParams.DeltaTime;
+					}
+				}
+			}
+		});
+	}
+
+	float MaxVelocityDifference(TConstArrayView<float> AX, TConstArrayView<float> AY, TConstArrayView<float> BX, TConstArrayView<float> BY)
+	{
+		float MaxDifference = 0.0f;
+		for (int32 Index = 0; Index < AX.Num(); ++Index)
+		{
+			MaxDifference = FMath::Max(MaxDifference, FVector2f(AX[Index] - BX[Index], AY[Index] - BY[Index]).Size());
+		}
+		return MaxDifference;
+	}
+
+	/** FluidDivergence.usf와 같은 stencil로 현재 Velocity의 divergence (L2) */
+	double ComputeVelocityDivergenceNorm(const FFluidSimulationCPU& Simulation)
+	{
+		const int32 Resolution = Simulation.GetResolution();
+		const float HalfInvDx = 0.5f * static_cast<float>(Resolution);
+		const TConstArrayView<float> VelocityX = Simulation.GetVelocityX();
+		const TConstArrayView<float> VelocityY = Simulation.GetVelocityY();
+
+		double SumSquared = 0.0;
+		for (int32 Y = 0; Y < Resolution; ++Y)
+		{
+			for (int32 X = 0; X < Resolution; ++X)
+			{
+				const float Left = VelocityX[Y * Resolution + FMath::Max(X - 1, 0)];
+				const float Right = VelocityX[Y * Resolution + FMath::Min(X + 1, Resolution - 1)];
+				const float Top = VelocityY[FMath::Max(Y - 1, 0) * Resolution + X];
+				const float Bottom = VelocityY[FMath::Min(Y + 1, Resolution - 1) * Resolution + X];
+				SumSquared += FMath::Square(static_cast<double>(((Right - Left) + (Bottom - Top)) * HalfInvDx));
+			}
+		}
+		return FMath::Sqrt(SumSquared);
+	}
+
+	double ComputeNorm(TConstArrayView<float> Grid)
+	{
+		double SumSquared = 0.0;
+		for (const float Value : Grid)
+		{
+			SumSquared += FMath::Square(static_cast<double>(Value));
+		}
+		return FMath::Sqrt(SumSquared);
+	}
+
+	double ComputeSum(TConstArrayView<float> Grid)
+	{
+		double Sum = 0.0;
+		for (const float Value : Grid)
+		{
+			Sum += Value;
+		}
+		return Sum;
+	}
+
+	/** Velocity가 0일 때 Density만으로 정해지는 활성 tile (Threshold 초과 셀이 있는 tile + Dilation 칸) */
+	TArray<uint8> ComputeExpectedActiveTiles(TConstArrayView<float> Density, int32 Resolution, float Threshold, int32 Dilation)
+	{
+		constexpr int32 TileSize = FluidActiveTiles::TileSize;
+		const int32 NumTiles = FMath::DivideAndRoundUp(Resolution, TileSize);
+
+		TArray<uint8> ActiveTiles;
+		ActiveTiles.SetNumZeroed(NumTiles * NumTiles);
+		for (int32 Y = 0; Y < Resolution; ++Y)
+		{
+			for (int32 X = 0; X < Resolution; ++X)
+			{
+				if (FMath::Abs(Density[Y * Resolution + X]) <= Threshold)
+				{
+					continue;
+				}
+
+				const int32 TileX = X / TileSize;
+				const int32 TileY = Y / TileSize;
+				for (int32 DilatedY = FMath::Max(TileY - Dilation, 0); DilatedY <= FMath::Min(TileY + Dilation, NumTiles - 1); ++DilatedY)
+				{
+					for (int32 DilatedX = FMath::Max(TileX - Dilation, 0); DilatedX <= FMath::Min(TileX + Dilation, NumTiles - 1); ++DilatedX)
+					{
+						ActiveTiles[DilatedY * NumTiles + DilatedX] = 1;
+					}
+				}
+			}
+		}
+		return ActiveTiles;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFluidSimulationMacCormackAdvectionTest, "VolumetricFog.Simulation.MacCormackAdvection",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFluidSimulationMacCormackAdvectionTest::RunTest(const FString& Parameters)
+{
+	using namespace FluidSimulationCPUTests;
+
+	float MacCormackErrors[2] = {};
+	for (int32 Case = 0; Case < 2; ++Case)
+	{
+		const int32 Resolution = 64 << Case;
+		// 가장자리에서 한 step에 약 1.1 cell 이동
+		const int32 NumSteps = 4 * Resolution;
+		const FRotatingBlobResult SemiLagrangian = RunRotatingBlob(Resolution, EFluidAdvectionMode::SemiLagrangian, NumSteps);
+		const FRotatingBlobResult MacCormack = RunRotatingBlob(Resolution, EFluidAdvectionMode::MacCormack, NumSteps);
+
+		AddInfo(FString::Printf(TEXT("%dx%d: Semi-Lagrangian L1 %.3f peak %.3f, MacCormack L1 %.3f peak %.3f"), Resolution, Resolution,
+			SemiLagrangian.RelativeL1Error, SemiLagrangian.MaxValue, MacCormack.RelativeL1Error, MacCormack.MaxValue));
+
+		TestTrue(FString::Printf(TEXT("%dx%d MacCormack L1 error is at least 25%% lower than Semi-Lagrangian"), Resolution, Resolution),
+			MacCormack.RelativeL1Error < 0.75f * SemiLagrangian.RelativeL1Error);
+		TestTrue(FString::Printf(TEXT("%dx%d MacCormack keeps more of the peak"), Resolution, Resolution),
+			MacCormack.MaxValue > 2.0f * SemiLagrangian.MaxValue);
+
+		// Limiter: 새 극값 없음
+		TestTrue(FString::Printf(TEXT("%dx%d MacCormack does not overshoot"), Resolution, Resolution), MacCormack.MaxValue <= 1.0f);
+		TestTrue(FString::Printf(TEXT("%dx%d MacCormack does not undershoot"), Resolution, Resolution), MacCormack.MinValue >= 0.0f);
+
+		MacCormackErrors[Case] = MacCormack.RelativeL1Error;
+	}
+
+	// 해상도를 올리면 오차가 줄어야 함
+	TestTrue(TEXT("MacCormack error halves from 64x64 to 128x128"), MacCormackErrors[1] < 0.5f * MacCormackErrors[0]);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFluidSimulationPrecisionDriftTest, "VolumetricFog.Simulation.PrecisionDrift",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFluidSimulationPrecisionDriftTest::RunTest(const FString& Parameters)
+{
+	using namespace FluidSimulationCPUTests;
+
+	// UFluidSimulationComponent 기본값 (CPUSimResolution = 64, Jacobi), 60Hz로 약 17초
+	constexpr int32 Resolution = 64;
+	constexpr int32 NumSteps = 1000;
+	constexpr float MaxRelativeL1Error = 0.05f;
+	constexpr float MaxMassDrift = 0.05f;
+
+	using EPrecision = EFluidTexturePrecision;
+	struct FPrecisionCase
+	{
+		const TCHAR* Name;
+		FFluidSimulationPrecision Precision;
+	};
+	const FPrecisionCase Cases[] =
+	{
+		{ TEXT("Full"), { EPrecision::Full, EPrecision::Full, EPrecision::Full } },
+		{ TEXT("Half Velocity"), { EPrecision::Half, EPrecision::Full, EPrecision::Full } },
+		{ TEXT("Half Density"), { EPrecision::Full, EPrecision::Half, EPrecision::Full } },
+		{ TEXT("Half Velocity + Density"), { EPrecision::Half, EPrecision::Half, EPrecision::Full } },
+		{ TEXT("Half Pressure"), { EPrecision::Full, EPrecision::Full, EPrecision::Half } },
+	};
+
+	const FFluidSimulationCPU Reference = RunPlumeScenario(Resolution, FFluidSimulationPrecision(), EFluidPressureSolverMode::Jacobi, NumSteps);
+
+	float JacobiHalfPressureError = 0.0f;
+	for (const FPrecisionCase& Case : Cases)
+	{
+		const FPrecisionDrift Drift = MeasureDrift(Reference,
+			RunPlumeScenario(Resolution, Case.Precision, EFluidPressureSolverMode::Jacobi, NumSteps));
+
+		AddInfo(FString::Printf(TEXT("%s: L1 %.5f, mass ratio %.5f"), Case.Name, Drift.DensityRelativeL1Error, Drift.MassRatio));
+
+		TestTrue(FString::Printf(TEXT("%s stays finite"), Case.Name), Drift.bFinite);
+		TestTrue(FString::Printf(TEXT("%s density L1 drift is within %.0f%%"), Case.Name, MaxRelativeL1Error * 100.0f),
+			Drift.DensityRelativeL1Error <= MaxRelativeL1Error);
+		TestTrue(FString::Printf(TEXT("%s mass drift is within %.0f%%"), Case.Name, MaxMassDrift * 100.0f),
+			FMath::Abs(Drift.MassRatio - 1.0f) <= MaxMassDrift);
+
+		// 32-bit는 반올림하지 않으므로 reference와 같아야 함
+		if (Case.Precision.Velocity == EPrecision::Full && Case.Precision.Density == EPrecision::Full && Case.Precision.Pressure == EPrecision::Full)
+		{
+			TestEqual(TEXT("Full precision has no drift"), Drift.DensityRelativeL1Error, 0.0f);
+		}
+		else if (Case.Precision.Pressure == EPrecision::Half)
+		{
+			JacobiHalfPressureError = Drift.DensityRelativeL1Error;
+		}
+	}
+
+	// 16-bit Pressure는 Jacobi 밖에서 drift가 훨씬 커짐 (PressurePrecision 주석 근거)
+	FFluidSimulationPrecision HalfPressure;
+	HalfPressure.Pressure = EPrecision::Half;
+	for (const EFluidPressureSolverMode SolverMode : { EFluidPressureSolverMode::Multigrid, EFluidPressureSolverMode::RedBlackSOR })
+	{
+		const FFluidSimulationCPU SolverReference = RunPlumeScenario(Resolution, FFluidSimulationPrecision(), SolverMode, NumSteps);
+		const FPrecisionDrift Drift = MeasureDrift(SolverReference, RunPlumeScenario(Resolution, HalfPressure, SolverMode, NumSteps));
+		const TCHAR* SolverName = SolverMode == EFluidPressureSolverMode::Multigrid ? TEXT("Multigrid") : TEXT("RedBlackSOR");
+
+		AddInfo(FString::Printf(TEXT("Half Pressure (%s): L1 %.5f, mass ratio %.5f"), SolverName, Drift.DensityRelativeL1Error, Drift.MassRatio));
+
+		TestTrue(FString::Printf(TEXT("Half Pressure (%s) stays finite"), SolverName), Drift.bFinite);
+		TestTrue(FString::Printf(TEXT("Half Pressure drifts more with %s than with Jacobi"), SolverName),
+			Drift.DensityRelativeL1Error > 10.0f * JacobiHalfPressureError);
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFluidSimulationInteractionForceBinsTest, "VolumetricFog.Simulation.InteractionForceBins",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFluidSimulationInteractionForceBinsTest::RunTest(const FString& Parameters)
+{
+	using namespace FluidSimulationCPUTests;
+
+	constexpr int32 Resolution = 128;
+	constexpr float RadiusUV = 0.02f;
+
+	struct FForceCase
+	{
+		const TCHAR* Name;
+		int32 NumSources;
+		float SweepLengthUV;
+		/** 0이면 영역 전체에 고르게, 아니면 중심 주위 원 안에 몰림 */
+		float ClusterRadiusUV;
+	};
+	const FForceCase Cases[] =
+	{
+		{ TEXT("Uniform"), 500, 0.0f, 0.0f },
+		{ TEXT("Uniform swept"), 500, 0.05f, 0.0f },
+		// 한 tile(8 cell = 0.0625 UV)에 수백 개
+		{ TEXT("Clustered"), 300, 0.0f, 0.02f },
+	};
+
+	for (const FForceCase& Case : Cases)
+	{
+		FRandomStream Random(1337);
+		FFluidSimulationParams SimParams;
+		SimParams.DeltaTime = 1.0f;
+		SimParams.Dissipation = 1.0f;
+		for (int32 SourceIndex = 0; SourceIndex < Case.NumSources; ++SourceIndex)
+		{
+			FVector2f Position(Random.FRand(), Random.FRand());
+			if (Case.ClusterRadiusUV > 0.0f)
+			{
+				const float Angle = Random.FRandRange(0.0f, UE_TWO_PI);
+				Position = FVector2f(0.5f, 0.5f) + FVector2f(FMath::Cos(Angle), FMath::Sin(Angle)) * Case.ClusterRadiusUV * FMath::Sqrt(Random.FRand());
+			}
+			SimParams.InteractionForceSources.Add(MakeForceSource(Random, Position, RadiusUV, Case.SweepLengthUV, Resolution));
+		}
+
+		FFluidSimulationCPU Binned;
+		Binned.Init(Resolution);
+		Binned.ApplyInteractionForces(SimParams);
+
+		const FFluidInteractionForceBins& Bins = Binned.GetForceBins();
+		int32 MaxSourcesInTile = 0;
+		for (int32 TileIndex = 0; TileIndex < Bins.NumTiles * Bins.NumTiles; ++TileIndex)
+		{
+			MaxSourcesInTile = FMath::Max(MaxSourcesInTile, Bins.GetTileSourceCount(TileIndex));
+		}
+
+		TArray<float> CutoffX, CutoffY, ExactX, ExactY;
+		ApplyForcesBruteForce(SimParams, Resolution, true, CutoffX, CutoffY);
+		ApplyForcesBruteForce(SimParams, Resolution, false, ExactX, ExactY);
+
+		const float BinningError = MaxVelocityDifference(Binned.GetVelocityX(), Binned.GetVelocityY(), CutoffX, CutoffY);
+		const float CutoffError = MaxVelocityDifference(Binned.GetVelocityX(), Binned.GetVelocityY(), ExactX, ExactY);
+
+		// Cutoff 밖 source 하나의 기여는 |F| * exp(-CutoffSquared / 2) 이하
+		const float ForceMagnitude = static_cast<float>(Resolution);
+		const float CutoffErrorBound = MaxSourcesInTile * ForceMagnitude * FMath::Exp(-0.5f * FluidInteractionForceBins::CutoffSquared);
+
+		AddInfo(FString::Printf(TEXT("%s: %d sources, %d bin entries, max %d per tile, binning error %g, cutoff error %.4f (bound %.4f)"),
+			Case.Name, Case.NumSources, Bins.SourceIndices.Num(), MaxSourcesInTile, BinningError, CutoffError, CutoffErrorBound));
+
+		// Tile에 걸치지 않는 source는 tile 안 모든 셀에서 cutoff 밖이므로 binning 자체로는 오차가 없어야 함
+		TestTrue(FString::Printf(TEXT("%s binned forces match the brute force march with the same cutoff"), Case.Name),
+			BinningError <= 1e-4f * ForceMagnitude);
+		TestTrue(FString::Printf(TEXT("%s cutoff error is within the per-source tail bound"), Case.Name), CutoffError <= CutoffErrorBound);
+
+		if (Case.ClusterRadiusUV > 0.0f)
+		{
+			TestTrue(FString::Printf(TEXT("%s puts more than 64 sources in one tile"), Case.Name), MaxSourcesInTile > 64);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFluidSimulationStepTest, "VolumetricFog.Simulation.Step",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFluidSimulationStepTest::RunTest(const FString& Parameters)
+{
+	using namespace FluidSimulationCPUTests;
+
+	constexpr int32 Resolution = 64;
+	// 60Hz로 4초
+	constexpr int32 NumFreeSteps = 240;
+	constexpr float MaxProjectedDivergenceRatio = 0.1f;
+	constexpr float MaxMassDrift = 0.01f;
+
+	struct FStepCase
+	{
+		const TCHAR* Name;
+		EFluidPressureSolverMode PressureSolverMode;
+		int32 PressureIterations;
+		EFluidAdvectionMode AdvectionMode;
+	};
+	const FStepCase Cases[] =
+	{
+		{ TEXT("Jacobi"), EFluidPressureSolverMode::Jacobi, 20, EFluidAdvectionMode::SemiLagrangian },
+		{ TEXT("Jacobi x5"), EFluidPressureSolverMode::Jacobi, 100, EFluidAdvectionMode::SemiLagrangian },
+		{ TEXT("Multigrid"), EFluidPressureSolverMode::Multigrid, 20, EFluidAdvectionMode::SemiLagrangian },
+		{ TEXT("RedBlackSOR"), EFluidPressureSolverMode::RedBlackSOR, 20, EFluidAdvectionMode::SemiLagrangian },
+		{ TEXT("Multigrid MacCormack"), EFluidPressureSolverMode::Multigrid, 20, EFluidAdvectionMode::MacCormack },
+	};
+
+	double JacobiRatio = 1.0;
+	for (const FStepCase& Case : Cases)
+	{
+		FFluidSimulationCPU Simulation;
+		Simulation.Init(Resolution);
+		const TArray<float> InitialDensity = MakePlumeDensity(Resolution, FVector2f(0.5f, 0.5f), 0.15f);
+		Simulation.SetDensity(InitialDensity);
+
+		// Source, 감쇠, Density Maintenance 없음
+		FFluidSimulationParams SimParams;
+		SimParams.DeltaTime = 1.0f / 60.0f;
+		SimParams.Dissipation = 1.0f;
+		SimParams.bEnableDensityMaintenance = false;
+		SimParams.PressureSolverMode = Case.PressureSolverMode;
+		SimParams.PressureIterations = Case.PressureIterations;
+		SimParams.AdvectionMode = Case.AdvectionMode;
+
+		// 첫 step만 force로 발산하는 속도장을 만듦
+		FRandomStream Random(7);
+		for (int32 SourceIndex = 0; SourceIndex < 8; ++SourceIndex)
+		{
+			const FVector2f Position(Random.FRandRange(0.3f, 0.7f), Random.FRandRange(0.3f, 0.7f));
+			SimParams.InteractionForceSources.Add(MakeForceSource(Random, Position, 0.05f, 0.0f, 4 * Resolution));
+		}
+		Simulation.Step(SimParams);
+
+		// GetDivergence()는 Pressure solve 전, Velocity는 Gradient Subtract 후
+		const double PreSolveDivergence = ComputeNorm(Simulation.GetDivergence());
+		const double ProjectedDivergence = ComputeVelocityDivergenceNorm(Simulation);
+		const double DivergenceRatio = ProjectedDivergence / FMath::Max(PreSolveDivergence, UE_DOUBLE_SMALL_NUMBER);
+
+		SimParams.InteractionForceSources.Reset();
+		for (int32 Step = 0; Step < NumFreeSteps; ++Step)
+		{
+			Simulation.Step(SimParams);
+		}
+		const double MassRatio = ComputeSum(Simulation.GetDensity()) / ComputeSum(InitialDensity);
+
+		AddInfo(FString::Printf(TEXT("%s: divergence %.1f -> %.1f (ratio %.4f), mass ratio %.5f after %d steps"),
+			Case.Name, PreSolveDivergence, ProjectedDivergence, DivergenceRatio, MassRatio, NumFreeSteps + 1));
+
+		TestTrue(FString::Printf(TEXT("%s velocity is divergent before the solve"), Case.Name), PreSolveDivergence > 0.0);
+		TestTrue(FString::Printf(TEXT("%s projection reduces divergence"), Case.Name), DivergenceRatio < 1.0);
+		TestTrue(FString::Printf(TEXT("%s mass drift is within %.0f%%"), Case.Name, MaxMassDrift * 100.0f),
+			FMath::Abs(MassRatio - 1.0) <= MaxMassDrift);
+
+		if (Case.PressureSolverMode == EFluidPressureSolverMode::Jacobi)
+		{
+			// Jacobi 20회는 저주파 성분이 남으므로 반복 횟수에 따라 줄어드는지만 확인
+			TestTrue(FString::Printf(TEXT("%s reduces divergence more than fewer iterations"), Case.Name), DivergenceRatio <= JacobiRatio);
+			JacobiRatio = DivergenceRatio;
+		}
+		else
+		{
+			TestTrue(FString::Printf(TEXT("%s projected divergence is below %.0f%% of the pre-solve value"), Case.Name, MaxProjectedDivergenceRatio * 100.0f),
+				DivergenceRatio < MaxProjectedDivergenceRatio);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFluidSimulationActiveTilesTest, "VolumetricFog.Simulation.ActiveTiles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFluidSimulationActiveTilesTest::RunTest(const FString& Parameters)
+{
+	using namespace FluidSimulationCPUTests;
+
+	constexpr int32 Resolution = 128;
+	constexpr int32 TileSize = FluidActiveTiles::TileSize;
+	constexpr int32 NumTiles = Resolution / TileSize;
+	// 60Hz로 1초 (Velocity가 퍼지면서 활성 영역이 grid 대부분으로 넓어짐)
+	constexpr int32 NumSteps = 60;
+	constexpr float MaxDensityError = 1e-3f;
+	constexpr float MaxVelocityError = 1e-3f;
+	// Threshold(0.01) * 1.02
+	constexpr float FaintBackground = 0.0102f;
+	constexpr int32 NumRetireSteps = 30;
+
+	// 중심 plume, 반경 0.25 밖은 비어 있음
+	TArray<float> PlumeDensity = MakePlumeDensity(Resolution, FVector2f(0.5f, 0.5f), 0.08f);
+	for (int32 Y = 0; Y < Resolution; ++Y)
+	{
+		for (int32 X = 0; X < Resolution; ++X)
+		{
+			const FVector2f UV((X + 0.5f) / Resolution, (Y + 0.5f) / Resolution);
+			if ((UV - FVector2f(0.5f, 0.5f)).Size() > 0.25f)
+			{
+				PlumeDensity[Y * Resolution + X] = 0.0f;
+			}
+		}
+	}
+
+	FFluidSimulationParams BaseParams;
+	BaseParams.DeltaTime = 1.0f / 60.0f;
+	BaseParams.Dissipation = 0.999f;
+	BaseParams.bEnableDensityMaintenance = false;
+	BaseParams.InteractionForceSources.SetNum(1);
+
+	// Plume 안을 도는 force (cutoff 반경 4 * 0.03 UV도 plume 활성 영역 안)
+	auto RunSteps = [&BaseParams](FFluidSimulationCPU& Simulation, EFluidPressureSolverMode SolverMode, bool bActiveTiles, int32 NumStepsToRun)
+	{
+		FFluidSimulationParams SimParams = BaseParams;
+		SimParams.PressureSolverMode = SolverMode;
+		SimParams.bActiveTiles = bActiveTiles;
+		for (int32 Step = 0; Step < NumStepsToRun; ++Step)
+		{
+			const float Angle = UE_TWO_PI * static_cast<float>(Step) / 120.0f;
+			FFluidInteractionForceSource& Source = SimParams.InteractionForceSources[0];
+			Source.PositionRadius = FVector4f(0.5f + 0.05f * FMath::Cos(Angle), 0.5f + 0.05f * FMath::Sin(Angle), 0.03f, 0.03f);
+			Source.ForceDensity = FVector4f(-FMath::Sin(Angle) * 2.0f * Resolution, FMath::Cos(Angle) * 2.0f * Resolution, 0.0f, 1.0f);
+			Simulation.Step(SimParams);
+		}
+	};
+
+	// 첫 step의 활성 tile은 초기 Density만으로 정해짐
+	const TArray<uint8> ExpectedActiveTiles = ComputeExpectedActiveTiles(PlumeDensity, Resolution, BaseParams.ActiveTileDensityThreshold, BaseParams.ActiveTileDilation);
+	int32 NumExpectedActiveTiles = 0;
+	for (const uint8 bActive : ExpectedActiveTiles)
+	{
+		NumExpectedActiveTiles += bActive;
+	}
+	const float ExpectedFraction = static_cast<float>(NumExpectedActiveTiles) / (NumTiles * NumTiles);
+
+	// 비활성 영역이 비어 있으면 dense와 같은 결과 (Multigrid는 Pressure를 grid 전체에서 풀어 제외)
+	for (const EFluidPressureSolverMode SolverMode : { EFluidPressureSolverMode::Jacobi, EFluidPressureSolverMode::RedBlackSOR })
+	{
+		const TCHAR* SolverName = SolverMode == EFluidPressureSolverMode::Jacobi ? TEXT("Jacobi") : TEXT("RedBlackSOR");
+
+		FFluidSimulationCPU Dense, Sparse;
+		Dense.Init(Resolution);
+		Sparse.Init(Resolution);
+		Dense.SetDensity(PlumeDensity);
+		Sparse.SetDensity(PlumeDensity);
+
+		RunSteps(Dense, SolverMode, false, 1);
+		RunSteps(Sparse, SolverMode, true, 1);
+		const float FirstStepFraction = Sparse.GetLastActiveTileFraction();
+
+		RunSteps(Dense, SolverMode, false, NumSteps - 1);
+		RunSteps(Sparse, SolverMode, true, NumSteps - 1);
+
+		const TConstArrayView<float> DenseDensity = Dense.GetDensity();
+		const TConstArrayView<float> SparseDensity = Sparse.GetDensity();
+		double DensityAbsSum = 0.0;
+		double DenseSum = 0.0;
+		for (int32 Index = 0; Index < DenseDensity.Num(); ++Index)
+		{
+			DensityAbsSum += FMath::Abs(static_cast<double>(SparseDensity[Index]) - DenseDensity[Index]);
+			DenseSum += FMath::Abs(DenseDensity[Index]);
+		}
+		const float DensityError = static_cast<float>(DensityAbsSum / DenseSum);
+
+		float MaxSpeed = 0.0f;
+		for (int32 Index = 0; Index < DenseDensity.Num(); ++Index)
+		{
+			MaxSpeed = FMath::Max(MaxSpeed, FVector2f(Dense.GetVelocityX()[Index], Dense.GetVelocityY()[Index]).Size());
+		}
+		const float VelocityError = MaxVelocityDifference(Sparse.GetVelocityX(), Sparse.GetVelocityY(), Dense.GetVelocityX(), Dense.GetVelocityY()) / MaxSpeed;
+
+		AddInfo(FString::Printf(TEXT("%s: first step %.3f of tiles active (expected %.3f), after %d steps %.3f, density L1 %g, velocity error %g"),
+			SolverName, FirstStepFraction, ExpectedFraction, NumSteps, Sparse.GetLastActiveTileFraction(), DensityError, VelocityError));
+
+		TestEqual(FString::Printf(TEXT("%s dense active tile fraction"), SolverName), Dense.GetLastActiveTileFraction(), 1.0f);
+		TestEqual(FString::Printf(TEXT("%s first step active tile fraction"), SolverName), FirstStepFraction, ExpectedFraction);
+		TestTrue(FString::Printf(TEXT("%s sparse density matches dense within %g"), SolverName, MaxDensityError), DensityError <= MaxDensityError);
+		TestTrue(FString::Printf(TEXT("%s sparse velocity matches dense within %g of the max speed"), SolverName, MaxVelocityError), VelocityError <= MaxVelocityError);
+	}
+
+	// Threshold 바로 위의 배경은 Dissipation으로 약 20 step 뒤 threshold 아래로 내려가 retire (force 없이 plume은 제자리)
+	TArray<float> FaintDensity = PlumeDensity;
+	for (float& Value : FaintDensity)
+	{
+		Value = FMath::Max(Value, FaintBackground);
+	}
+
+	FFluidSimulationParams RetireParams = BaseParams;
+	RetireParams.InteractionForceSources.Reset();
+
+	FFluidSimulationCPU Dense, Sparse;
+	Dense.Init(Resolution);
+	Sparse.Init(Resolution);
+	Dense.SetDensity(FaintDensity);
+	Sparse.SetDensity(FaintDensity);
+	for (int32 Step = 0; Step < NumRetireSteps; ++Step)
+	{
+		RetireParams.bActiveTiles = false;
+		Dense.Step(RetireParams);
+		RetireParams.bActiveTiles = true;
+		Sparse.Step(RetireParams);
+	}
+
+	int32 NumNonZeroRetiredCells = 0;
+	int32 NumFaintDenseCells = 0;
+	for (int32 Y = 0; Y < Resolution; ++Y)
+	{
+		for (int32 X = 0; X < Resolution; ++X)
+		{
+			if (ExpectedActiveTiles[(Y / TileSize) * NumTiles + X / TileSize])
+			{
+				continue;
+			}
+
+			const int32 Index = Y * Resolution + X;
+			NumNonZeroRetiredCells += Sparse.GetDensity()[Index] != 0.0f || Sparse.GetVelocityX()[Index] != 0.0f
+				|| Sparse.GetVelocityY()[Index] != 0.0f || Sparse.GetPressure()[Index] != 0.0f ? 1 : 0;
+			NumFaintDenseCells += Dense.GetDensity()[Index] > 0.0f ? 1 : 0;
+		}
+	}
+
+	AddInfo(FString::Printf(TEXT("Faint background: %.3f of tiles active after %d steps"), Sparse.GetLastActiveTileFraction(), NumRetireSteps));
+
+	TestEqual(TEXT("Faint background tiles retire"), Sparse.GetLastActiveTileFraction(), ExpectedFraction);
+	TestTrue(TEXT("Dense simulation keeps the faint background"), NumFaintDenseCells > 0);
+	TestEqual(TEXT("Cells in retired tiles that are not zero"), NumNonZeroRetiredCells, 0);
+
+	return true;
+}
+
+#endif
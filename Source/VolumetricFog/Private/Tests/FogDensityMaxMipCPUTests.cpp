@@ -0,0 +1,206 @@
+#include "FogDensityMaxMipCPU.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FogDensityMaxMipCPUTests
+{
+	/** 작은 Gaussian plume 몇 개 (나머지는 빈 공간) */
+	TArray<float> MakeSparsePlumeDensity(int32 Resolution, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<float> Density;
+		Density.SetNumZeroed(Resolution * Resolution);
+
+		for (int32 Plume = 0; Plume < 4; ++Plume)
+		{
+			const FVector2f Center(Random.FRandRange(0.15f, 0.85f), Random.FRandRange(0.15f, 0.85f));
+			const float Radius = Random.FRandRange(0.03f, 0.08f);
+			const float Amplitude = Random.FRandRange(100.0f, 500.0f);
+
+			for (int32 Y = 0; Y < Resolution; ++Y)
+			{
+				for (int32 X = 0; X < Resolution; ++X)
+				{
+					const FVector2f UV((X + 0.5f) / Resolution, (Y + 0.5f) / Resolution);
+					Density[Y * Resolution + X] += Amplitude * FMath::Exp(-0.5f * (UV - Center).SizeSquared() / FMath::Square(Radius));
+				}
+			}
+		}
+		return Density;
+	}
+
+	/** FogCommon.ush WorldToSimulationUV */
+	FVector2f WorldToSimulationUV(const FFluidFogRenderState& State, const FVector3f& WorldPos)
+	{
+		const FVector2f SafeExtents(FMath::Max(State.SimulationExtents.X, 1e-3f), FMath::Max(State.SimulationExtents.Y, 1e-3f));
+		const FVector2f LocalXY = FVector2f(WorldPos.X - State.SimulationCenter.X, WorldPos.Y - State.SimulationCenter.Y);
+		FVector2f UV = (LocalXY + SafeExtents) / (SafeExtents * 2.0f);
+		UV.Y = 1.0f - UV.Y;
+		return UV;
+	}
+
+	/** FogRayMarch.usf IntegrateRay의 step 수 */
+	int32 ComputeNumSteps(const FFluidFogRenderState& State, float RayLength)
+	{
+		const int32 AdaptiveSteps = FMath::CeilToInt(RayLength / 100.0f);
+		const int32 MaxSteps = FMath::Max(State.NumSteps, 1);
+		return FMath::Clamp(AdaptiveSteps, FMath::Min(12, MaxSteps), MaxSteps);
+	}
+
+	float ComputeSigmaT(const FFluidFogRenderState& State, float Density)
+	{
+		return FMath::Max(Density * (FMath::Max(State.AbsorptionScale, 0.0f) + FMath::Max(State.ScatteringScale, 0.0f)), 1e-6f);
+	}
+
+	/** Box를 지나는 Ray ([TStart, TEnd]는 Box 안으로 자른 구간) */
+	struct FRay
+	{
+		FVector3f Origin;
+		FVector3f Dir;
+		float TStart = 0.0f;
+		float TEnd = 0.0f;
+	};
+
+	/** Box 밖 임의 위치에서 Box 안 임의 위치를 향하는 Ray */
+	TArray<FRay> MakeRays(const FFluidFogRenderState& State, int32 NumRays, int32 Seed)
+	{
+		const FVector3f BoxMin = State.SimulationCenter - State.SimulationExtents;
+		const FVector3f BoxSize = State.SimulationExtents * 2.0f;
+
+		TArray<FRay> Rays;
+		Rays.Reserve(NumRays);
+		FRandomStream Random(Seed);
+		for (int32 Index = 0; Index < NumRays; ++Index)
+		{
+			const FVector3f Target = BoxMin + FVector3f(Random.GetFraction(), Random.GetFraction(), Random.GetFraction()) * BoxSize;
+			const FVector3f Origin = State.SimulationCenter + FVector3f(Random.GetUnitVector()) * BoxSize.GetMax() * 1.5f;
+
+			FRay& Ray = Rays.AddDefaulted_GetRef();
+			Ray.Origin = Origin;
+			Ray.Dir = (Target - Origin).GetSafeNormal();
+
+			// slab method
+			float TEntry = 0.0f;
+			float TExit = UE_BIG_NUMBER;
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const float SafeDir = FMath::Abs(Ray.Dir[Axis]) < 1e-6f ? (Ray.Dir[Axis] >= 0.0f ? 1e-6f : -1e-6f) : Ray.Dir[Axis];
+				const float T0 = (BoxMin[Axis] - Origin[Axis]) / SafeDir;
+				const float T1 = (BoxMin[Axis] + BoxSize[Axis] - Origin[Axis]) / SafeDir;
+				TEntry = FMath::Max(TEntry, FMath::Min(T0, T1));
+				TExit = FMath::Min(TExit, FMath::Max(T0, T1));
+			}
+			Ray.TStart = TEntry;
+			Ray.TEnd = FMath::Min(TExit, State.MaxRayDistance);
+		}
+		return Rays;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFogDensityMaxMipSkippingTest, "VolumetricFog.EmptySpaceSkipping.MatchesBruteForceMarch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFogDensityMaxMipSkippingTest::RunTest(const FString& Parameters)
+{
+	using namespace FogDensityMaxMipCPUTests;
+
+	constexpr int32 DensityResolution = 64;
+	constexpr int32 NumRays = 4096;
+
+	const TArray<float> Density = MakeSparsePlumeDensity(DensityResolution, 11);
+	FFogDensityFieldCPU Field;
+	Field.Density = Density;
+	Field.Resolution = DensityResolution;
+
+	// 20m x 20m, FogBaseHeight ~ FogMaxHeight를 덮는 Box
+	FFluidFogRenderState State;
+	State.SimulationCenter = FVector3f(0.0f, 0.0f, 250.0f);
+	State.SimulationExtents = FVector3f(1000.0f, 1000.0f, 250.0f);
+
+	const TArray<FRay> Rays = MakeRays(State, NumRays, 1337);
+
+	// 기본 DensityMaxMipCellSize와 그보다 촘촘한 / 성긴 Cell
+	for (const int32 CellSize : { 4, 8, 16 })
+	{
+		FFogDensityMaxMipCPU MaxMip;
+		MaxMip.Build(Field, CellSize);
+		const int32 BaseSize = MaxMip.GetBaseSize();
+
+		int64 BruteForceSamples = 0;
+		int64 SkippingSamples = 0;
+		int32 NumConservativeViolations = 0;
+		int32 NumMismatchedRays = 0;
+		float MaxOpticalDepthError = 0.0f;
+
+		for (const FRay& Ray : Rays)
+		{
+			const float RayLength = Ray.TEnd - Ray.TStart;
+			if (RayLength <= 1e-6f)
+			{
+				continue;
+			}
+
+			// 두 방식 모두 T = TStart + i * StepSize (Transmittance 조기 종료 없음)
+			const int32 Steps = ComputeNumSteps(State, RayLength);
+			const float StepSize = RayLength / Steps;
+
+			float Reference = 0.0f;
+			for (int32 Step = 0; Step < Steps; ++Step)
+			{
+				const FVector3f P = Ray.Origin + Ray.Dir * (Ray.TStart + Step * StepSize);
+				const float SampleDensity = FFogShadowVolumeCPU::SampleDensity(State, Field, P);
+				++BruteForceSamples;
+				if (SampleDensity > 1e-6f)
+				{
+					Reference += ComputeSigmaT(State, SampleDensity) * StepSize * 0.01f;
+
+					// Density가 있는데 Mip 0 Cell이 비어 있다고 판단되면 안 됨
+					const FVector2f UV = WorldToSimulationUV(State, P);
+					const float MaxDensity = MaxMip.GetMaxDensity(0, FMath::FloorToInt(UV.X * BaseSize), FMath::FloorToInt(UV.Y * BaseSize));
+					NumConservativeViolations += FFogDensityMaxMipCPU::IsMaxDensityEmpty(State, MaxDensity) ? 1 : 0;
+				}
+			}
+
+			float OpticalDepth = 0.0f;
+			for (int32 Step = 0; Step < Steps; ++Step)
+			{
+				const float T = Ray.TStart + Step * StepSize;
+
+				// FogRayMarch.usf와 같이 빈 Cell 안의 step은 건너뜀
+				const float SkipT = FMath::Min(MaxMip.SkipEmptyDensity(State, Ray.Origin, Ray.Dir, T), Ray.TEnd + StepSize);
+				const int32 SkipSteps = FMath::FloorToInt((SkipT - T) / StepSize);
+				if (SkipSteps > 0)
+				{
+					Step += SkipSteps - 1;
+					continue;
+				}
+
+				const float SampleDensity = FFogShadowVolumeCPU::SampleDensity(State, Field, Ray.Origin + Ray.Dir * T);
+				++SkippingSamples;
+				if (SampleDensity > 1e-6f)
+				{
+					OpticalDepth += ComputeSigmaT(State, SampleDensity) * StepSize * 0.01f;
+				}
+			}
+
+			// 같은 step 위치에서 빈 sample만 건너뛰므로 합도 같아야 함
+			const float Error = FMath::Abs(OpticalDepth - Reference);
+			MaxOpticalDepthError = FMath::Max(MaxOpticalDepthError, Error);
+			NumMismatchedRays += Error > 0.0f ? 1 : 0;
+		}
+
+		AddInfo(FString::Printf(TEXT("Cell %d: %lld / %lld samples with skipping, max optical depth error %g"),
+			CellSize, SkippingSamples, BruteForceSamples, MaxOpticalDepthError));
+
+		TestEqual(FString::Printf(TEXT("Cell %d: samples with density inside an empty Mip 0 cell"), CellSize), NumConservativeViolations, 0);
+		TestEqual(FString::Printf(TEXT("Cell %d: rays whose optical depth differs from the brute force march"), CellSize), NumMismatchedRays, 0);
+		TestTrue(FString::Printf(TEXT("Cell %d: skipping takes at most 75%% of the density samples"), CellSize),
+			SkippingSamples < BruteForceSamples * 3 / 4);
+	}
+
+	return true;
+}
+
+#endif
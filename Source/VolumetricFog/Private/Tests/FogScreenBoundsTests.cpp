@@ -0,0 +1,111 @@
+#include "FogScreenBounds.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FogScreenBoundsTests
+{
+	/** 테스트용 카메라 (FOV 90, ViewRect 비율, Reversed-Z) */
+	FMatrix MakeViewProjectionMatrix(const FVector& Eye, const FVector& Target, const FIntRect& ViewRect, double NearPlane)
+	{
+		const FMatrix ViewMatrix = FLookAtMatrix(Eye, Target, FVector::UpVector);
+		const FMatrix ProjectionMatrix = FReversedZPerspectiveMatrix(UE_HALF_PI * 0.5,
+			static_cast<float>(ViewRect.Width()), static_cast<float>(ViewRect.Height()), NearPlane);
+		return ViewMatrix * ProjectionMatrix;
+	}
+
+	/** Box 안 임의 위치 중 Near Plane 앞, 화면 안에 투영되는 것이 Rect 밖으로 나간 개수 */
+	int32 CountSamplesOutsideRect(const FFogScreenBounds& Bounds, const FMatrix& ViewProjectionMatrix, const FBox& Box,
+		const FIntRect& ViewRect, double NearPlane, int32 NumSamples, FRandomStream& Random)
+	{
+		const FVector BoxSize = Box.GetSize();
+		int32 NumOutside = 0;
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			const FVector Position = Box.Min + FVector(Random.GetFraction(), Random.GetFraction(), Random.GetFraction()) * BoxSize;
+			const FVector4 Clip = ViewProjectionMatrix.TransformFVector4(FVector4(Position, 1.0));
+			if (Clip.W < NearPlane)
+			{
+				continue;
+			}
+
+			const FVector2D NDC(Clip.X / Clip.W, Clip.Y / Clip.W);
+			if (FMath::Abs(NDC.X) > 1.0 || FMath::Abs(NDC.Y) > 1.0)
+			{
+				continue;
+			}
+
+			// NDC → 픽셀 (Y 반전)
+			const FVector2D Pixel(
+				ViewRect.Min.X + (NDC.X * 0.5 + 0.5) * ViewRect.Width(),
+				ViewRect.Min.Y + (0.5 - NDC.Y * 0.5) * ViewRect.Height());
+			const bool bInside = Pixel.X >= Bounds.Rect.Min.X && Pixel.X <= Bounds.Rect.Max.X
+				&& Pixel.Y >= Bounds.Rect.Min.Y && Pixel.Y <= Bounds.Rect.Max.Y;
+			NumOutside += bInside ? 0 : 1;
+		}
+		return NumOutside;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFogScreenBoundsScissorTest, "VolumetricFog.ScreenBounds.Scissor",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFogScreenBoundsScissorTest::RunTest(const FString& Parameters)
+{
+	using namespace FogScreenBoundsTests;
+
+	struct FCase
+	{
+		const TCHAR* Name;
+		FVector Eye;
+		FVector Target;
+		FBox Box;
+		bool bExpectVisible;
+		bool bExpectCameraInside;
+		bool bExpectNearClip;
+	};
+
+	// 카메라는 +X를 봄
+	const FCase Cases[] =
+	{
+		{ TEXT("InFront"),        FVector::ZeroVector, FVector(1, 0, 0),   FBox::BuildAABB(FVector(2000, 300, 100), FVector(200)),        true,  false, false },
+		{ TEXT("CameraInside"),   FVector::ZeroVector, FVector(1, 0, 0),   FBox::BuildAABB(FVector(100, 0, 0), FVector(500)),             true,  true,  false },
+		{ TEXT("StraddleNear"),   FVector::ZeroVector, FVector(1, 0, 0),   FBox::BuildAABB(FVector(0, 400, 0), FVector(1000, 100, 100)),  true,  false, true  },
+		{ TEXT("BehindCamera"),   FVector::ZeroVector, FVector(1, 0, 0),   FBox::BuildAABB(FVector(-2000, 0, 0), FVector(500)),           false, false, true  },
+		{ TEXT("OutsideFrustum"), FVector::ZeroVector, FVector(1, 0, 0),   FBox::BuildAABB(FVector(500, 5000, 0), FVector(100)),          false, false, false },
+		{ TEXT("Distant"),        FVector(0, 0, 500),  FVector(1, 0, 500), FBox::BuildAABB(FVector(100000, 0, 500), FVector(50)),         true,  false, false },
+	};
+
+	// 원점이 아닌 ViewRect (Split screen / Editor viewport)
+	const FIntRect ViewRect(FIntPoint(64, 32), FIntPoint(64 + 1920, 32 + 1080));
+	constexpr double NearPlane = 10.0;
+	constexpr int32 NumSamplesPerCase = 4096;
+
+	FRandomStream Random(1337);
+	for (const FCase& Case : Cases)
+	{
+		const FMatrix ViewProjectionMatrix = MakeViewProjectionMatrix(Case.Eye, Case.Target, ViewRect, NearPlane);
+		const FFogScreenBounds Bounds = FFogScreenBounds::Compute(ViewProjectionMatrix, Case.Eye, Case.Box, ViewRect, NearPlane);
+
+		AddInfo(FString::Printf(TEXT("%s: Rect (%d, %d) - (%d, %d)"), Case.Name,
+			Bounds.Rect.Min.X, Bounds.Rect.Min.Y, Bounds.Rect.Max.X, Bounds.Rect.Max.Y));
+
+		TestEqual(FString::Printf(TEXT("%s is visible"), Case.Name), Bounds.IsVisible(), Case.bExpectVisible);
+		TestEqual(FString::Printf(TEXT("%s camera inside"), Case.Name), Bounds.bCameraInside, Case.bExpectCameraInside);
+		TestEqual(FString::Printf(TEXT("%s clipped by near plane"), Case.Name), Bounds.bClippedByNearPlane, Case.bExpectNearClip);
+
+		if (Case.bExpectCameraInside)
+		{
+			TestTrue(FString::Printf(TEXT("%s covers the whole view rect"), Case.Name), Bounds.Rect == ViewRect);
+		}
+
+		// 보수성: 화면에 보이는 Box 안 위치는 모두 Rect 안
+		TestEqual(FString::Printf(TEXT("%s samples projected outside the rect"), Case.Name),
+			CountSamplesOutsideRect(Bounds, ViewProjectionMatrix, Case.Box, ViewRect, NearPlane, NumSamplesPerCase, Random), 0);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,118 @@
+#include "FogShadowVolumeCPU.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace FogShadowVolumeCPUTests
+{
+	/** 크기 / 세기가 다른 Gaussian plume 몇 개 (최대 ~ BaseDensityTarget 크기) */
+	TArray<float> MakePlumeDensity(int32 Resolution, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		TArray<float> Density;
+		Density.SetNumZeroed(Resolution * Resolution);
+
+		for (int32 Plume = 0; Plume < 6; ++Plume)
+		{
+			const FVector2f Center(Random.FRand(), Random.FRand());
+			const float Radius = Random.FRandRange(0.05f, 0.2f);
+			const float Amplitude = Random.FRandRange(100.0f, 500.0f);
+
+			for (int32 Y = 0; Y < Resolution; ++Y)
+			{
+				for (int32 X = 0; X < Resolution; ++X)
+				{
+					const FVector2f UV((X + 0.5f) / Resolution, (Y + 0.5f) / Resolution);
+					Density[Y * Resolution + X] += Amplitude * FMath::Exp(-0.5f * (UV - Center).SizeSquared() / FMath::Square(Radius));
+				}
+			}
+		}
+		return Density;
+	}
+
+	/** Bake + lookup과 per-sample ray march의 Transmittance 차이 */
+	struct FTransmittanceError
+	{
+		float MeanError = 0.0f;
+		float MaxError = 0.0f;
+		bool bFinite = true;
+	};
+
+	/** Box 안의 임의 위치 NumSamples 개에서 비교 */
+	FTransmittanceError CompareWithPerSampleMarch(const FFluidFogRenderState& State, const FFogDensityFieldCPU& Field,
+		const FIntVector& Size, int32 NumSamples, int32 Seed)
+	{
+		FFogShadowVolumeCPU Volume;
+		Volume.Bake(State, Field, Size);
+
+		const FVector3f BoxMin = State.SimulationCenter - State.SimulationExtents;
+		const FVector3f BoxSize = State.SimulationExtents * 2.0f;
+
+		FTransmittanceError Result;
+		FRandomStream Random(Seed);
+		double ErrorSum = 0.0;
+		for (int32 Sample = 0; Sample < NumSamples; ++Sample)
+		{
+			const FVector3f Position = BoxMin + FVector3f(Random.GetFraction(), Random.GetFraction(), Random.GetFraction()) * BoxSize;
+			const float Reference = FMath::Exp(-FFogShadowVolumeCPU::ComputeLightOpticalDepth(State, Field, Position));
+			const float Baked = Volume.SampleTransmittance(State, Position);
+
+			Result.bFinite = Result.bFinite && FMath::IsFinite(Baked);
+			const float Error = FMath::Abs(Baked - Reference);
+			Result.MaxError = FMath::Max(Result.MaxError, Error);
+			ErrorSum += Error;
+		}
+		Result.MeanError = static_cast<float>(ErrorSum / FMath::Max(NumSamples, 1));
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFogShadowVolumeBakeAccuracyTest, "VolumetricFog.ShadowVolume.BakeAccuracy",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FFogShadowVolumeBakeAccuracyTest::RunTest(const FString& Parameters)
+{
+	using namespace FogShadowVolumeCPUTests;
+
+	constexpr int32 DensityResolution = 64;
+	constexpr int32 NumSamples = 4096;
+	constexpr float MaxMeanError = 0.01f;
+
+	const TArray<float> Density = MakePlumeDensity(DensityResolution, 5);
+	FFogDensityFieldCPU Field;
+	Field.Density = Density;
+	Field.Resolution = DensityResolution;
+
+	// 20m x 20m, FogBaseHeight ~ FogMaxHeight를 덮는 Box
+	FFluidFogRenderState State;
+	State.SimulationCenter = FVector3f(0.0f, 0.0f, 250.0f);
+	State.SimulationExtents = FVector3f(1000.0f, 1000.0f, 250.0f);
+
+	// 기본 ShadowVolumeResolution의 절반 / 기본 / 두 배
+	const FIntVector DefaultSize = State.ShadowVolumeResolution;
+	const FIntVector Sizes[] = { DefaultSize / 2, DefaultSize, DefaultSize * 2 };
+
+	float MeanErrors[UE_ARRAY_COUNT(Sizes)] = {};
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Sizes); ++Index)
+	{
+		const FIntVector& Size = Sizes[Index];
+		const FTransmittanceError Error = CompareWithPerSampleMarch(State, Field, Size, NumSamples, 1337);
+
+		// Max는 per-sample march의 early-out(Transmittance < 0.1) 경계에서 생기는 불연속이라 참고용
+		AddInfo(FString::Printf(TEXT("%dx%dx%d: mean error %.4f, max error %.4f"), Size.X, Size.Y, Size.Z, Error.MeanError, Error.MaxError));
+
+		TestTrue(FString::Printf(TEXT("%dx%dx%d transmittance is finite"), Size.X, Size.Y, Size.Z), Error.bFinite);
+		MeanErrors[Index] = Error.MeanError;
+	}
+
+	TestTrue(FString::Printf(TEXT("Default size mean transmittance error is below %.2f"), MaxMeanError), MeanErrors[1] < MaxMeanError);
+
+	// 해상도를 두 배로 올리면 오차가 절반 이하
+	TestTrue(TEXT("Mean error halves from half to default size"), MeanErrors[1] < 0.5f * MeanErrors[0]);
+	TestTrue(TEXT("Mean error halves from default to double size"), MeanErrors[2] < 0.5f * MeanErrors[1]);
+
+	return true;
+}
+
+#endif
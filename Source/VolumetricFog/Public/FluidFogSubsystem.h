@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FluidFogSubsystem.generated.h"
+
+class FFogSceneViewExtension;
+class FFogVolumeRenderProxy;
+class UFluidSimulationComponent;
+
+/** Fog Volume 하나의 Simulation schedule (UFluidFogSubsystem::Tick에서 갱신) */
+struct FFluidFogVolumeSchedule
+{
+	TWeakObjectPtr<UFluidSimulationComponent> Component;
+	
+	/** 마지막 step 이후 누적 시간 (다음 step의 DeltaTime) */
+	float PendingDeltaTime = 0.0f;
+	
+	/** 0 = SimResolution, 1 = 1/2, 2 = 1/4, INDEX_NONE = 화면 밖 */
+	int32 LODLevel = 0;
+	
+	/** 모든 View 중 최대 화면 점유율 (0~1) */
+	float ScreenCoverage = 1.0f;
+	
+	/** 해상도를 마지막으로 바꾼 뒤 지난 시간 (재샘플이 연달아 일어나지 않도록) */
+	float TimeSinceResolutionChange = 0.0f;
+};
+
+/**
+ * World의 모든 Fog Volume 관리
+ * - Rendering: 하나의 FFogSceneViewExtension(PostOpaque 델리게이트 하나)으로 렌더
+ * - Simulation: 화면 점유율 / 거리로 Volume마다 해상도와 tick 빈도를 고르고, 전체 GPU 시간 예산 안에서 step
+ * UFluidSimulationComponent가 BeginPlay / EndPlay에서 등록 / 해제
+ */
+UCLASS()
+class VOLUMETRICFOG_API UFluidFogSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+	
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	
+	void RegisterFogVolume(UFluidSimulationComponent* Component, const TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>& Volume);
+	void UnregisterFogVolume(UFluidSimulationComponent* Component, const TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>& Volume);
+	
+	int32 GetNumFogVolumes() const { return FogVolumes.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Local Player 카메라 기준 화면 점유율 → LOD, 카메라가 없으면(Server) 모두 LOD 0 */
+	void UpdateVolumeLODs(float DeltaTime);
+	
+	/** 이번 프레임 step할 Volume을 우선순위 순으로 GPU 예산 안에서 고르고 실행 */
+	void StepSimulations();
+	
+	/** 첫 Volume 등록 때 생성 (Initialize 시점에는 World Scene이 없을 수 있음) */
+	TSharedPtr<FFogSceneViewExtension, ESPMode::ThreadSafe> FogExtension;
+	
+	TArray<FFluidFogVolumeSchedule> FogVolumes;
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FluidSimulationComponent.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "UObject/ObjectKey.h"
+
+/** Interaction force source 계산 인자 (Game thread에서 캡처) */
+struct FFluidInteractionBuildParams
+{
+	FVector BoundsOrigin = FVector::ZeroVector;
+	FVector BoundsExtent = FVector::ZeroVector;
+	float DeltaTime = 0.0f;
+	int32 SimResolution = 0;
+	float RadiusMultiplier = 1.0f;
+	float ForceMultiplier = 1.0f;
+};
+
+/**
+ * Game thread → Render thread / CPU worker로 넘기는 Interaction force source 한 세트
+ * 입력(SoA)은 Game thread가 채우고 Sources는 BuildTask가 채움. 사용하는 쪽은 BuildTask 완료 후 읽음
+ */
+struct FFluidInteractionSourceSlot
+{
+	FFluidInteractionBuildParams Params;
+
+	/** 추적 중인 Component의 Bounds (Index는 같은 actor) */
+	TArray<FVector> PrevLocations;
+	TArray<FVector> Locations;
+	TArray<FVector2f> Extents;
+
+	TArray<FFluidInteractionForceSource> Sources;
+	FGraphEventRef BuildTask;
+
+	/** BuildTask 완료를 기다린 뒤 Sources를 OutSources로 옮김 (할당은 ReturnSources로 돌려줌) */
+	void TakeSources(TArray<FFluidInteractionForceSource>& OutSources);
+	void ReturnSources(TArray<FFluidInteractionForceSource>&& InSources);
+};
+
+/**
+ * Interaction volume과 겹친 Actor 목록 (SoA, Overlap 이벤트로만 갱신)
+ * Game thread는 Bounds만 slot으로 복사하고 Source 계산은 background task에서 진행
+ * Slot은 미리 할당한 ring을 재사용 (쓰는 쪽이 아직 잡고 있는 slot은 새로 할당)
+ */
+class VOLUMETRICFOG_API FFluidInteractionTracker
+{
+public:
+	static constexpr int32 NumSlots = 2;
+	/** 한 스텝 이동이 이보다 길면(UV) 순간이동으로 보고 swept source 대신 점 source */
+	static constexpr float MaxSweepLengthUV = 0.25f;
+
+	FFluidInteractionTracker();
+
+	/** 같은 Component는 한 번만 추적 */
+	void Add(UPrimitiveComponent* Comp);
+	void Remove(UPrimitiveComponent* Comp);
+	void Reset();
+
+	int32 Num() const { return Components.Num(); }
+
+	/** Game thread 전용, 추적 중인 actor가 없으면 nullptr */
+	TSharedPtr<FFluidInteractionSourceSlot, ESPMode::ThreadSafe> KickBuild(const FFluidInteractionBuildParams& Params);
+
+	/**
+	 * Slot 입력으로 Source 계산 (BuildTask 본문)
+	 * Bounds 밖이거나 움직이지 않은 actor는 제외, 속도는 Bounds 중심의 이동량 / DeltaTime
+	 * 이동 경로 전체를 덮는 swept source (SweepOffset), force는 적분이 점 source와 같도록 보정
+	 */
+	static void BuildSources(const FFluidInteractionBuildParams& Params, TConstArrayView<FVector> PrevLocations,
+		TConstArrayView<FVector> Locations, TConstArrayView<FVector2f> Extents, TArray<FFluidInteractionForceSource>& OutSources);
+
+private:
+	void RemoveAtSwap(int32 Index);
+
+	/** SoA (Index는 같은 actor) */
+	TArray<TWeakObjectPtr<UPrimitiveComponent>> Components;
+	TArray<FObjectKey> ComponentKeys;
+	TArray<FVector> LastLocations;
+	TMap<FObjectKey, int32> IndexByComponent;
+
+	TSharedPtr<FFluidInteractionSourceSlot, ESPMode::ThreadSafe> Slots[NumSlots];
+	int32 NextSlot = 0;
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** GPU(AddPressureMultigridPasses) / CPU Multigrid가 공유하는 설정 */
+namespace FluidMultigrid
+{
+	/** 이 해상도 이하가 되면 더 이상 coarse level을 만들지 않음 */
+	constexpr int32 MinResolution = 8;
+	constexpr int32 MaxLevels = 12;
+	
+	/** 가장 coarse한 level에서의 smoothing 횟수 */
+	constexpr int32 CoarsestIterations = 16;
+	
+	/** Weighted Jacobi 가중치 */
+	constexpr float SmoothWeight = 0.8f;
+}
+
+namespace FluidPressureSolverCPU
+{
+	/**
+	 * Row의 [XBegin, XEnd) 구간을 처리할 때 내부 구간 [1, Resolution - 1)은 4개씩 SIMD(VectorFunc),
+	 * 경계(Clamp가 필요한 셀)와 나머지는 Scalar(ScalarFunc)로 처리
+	 */
+	template<typename ScalarFuncType, typename VectorFuncType>
+	FORCEINLINE void ForEachRowSpan(int32 XBegin, int32 XEnd, int32 Resolution, ScalarFuncType&& ScalarFunc, VectorFuncType&& VectorFunc)
+	{
+		int32 X = XBegin;
+		if (X == 0 && X < XEnd)
+		{
+			ScalarFunc(X++);
+		}
+		const int32 VectorEnd = FMath::Min(XEnd, Resolution - 1);
+		for (; X + 4 <= VectorEnd; X += 4)
+		{
+			VectorFunc(X);
+		}
+		for (; X < XEnd; ++X)
+		{
+			ScalarFunc(X);
+		}
+	}
+	
+	template<typename ScalarFuncType, typename VectorFuncType>
+	FORCEINLINE void ForEachRowSpan(int32 Resolution, ScalarFuncType&& ScalarFunc, VectorFuncType&& VectorFunc)
+	{
+		ForEachRowSpan(0, Resolution, Resolution, Forward<ScalarFuncType>(ScalarFunc), Forward<VectorFuncType>(VectorFunc));
+	}
+}
+
+/**
+ * Pressure Poisson 방정식의 CPU Reference 구현
+ * GPU Shader(FluidDiffuse.usf, FluidPressure*.usf)와 같은 이산화/경계조건(Clamp = Neumann)을 사용하므로
+ * GPU 없이 (headless automation) 수렴성을 검증할 수 있다.
+ *
+ * 모든 Grid는 Resolution x Resolution, row-major (Index = Y * Resolution + X)
+ */
+class VOLUMETRICFOG_API FFluidPressureSolverCPU
+{
+public:
+	/** FluidDiffuse.usf 한 row: Output = (L + R + T + B + Alpha * Prev) * InvBeta (SIMD, Scalar와 같은 연산 순서) */
+	static void JacobiRow(const float* Input, const float* Prev, float* Output, int32 Y, int32 Resolution, float Alpha, float InvBeta);
+	
+	/** JacobiRow의 [XBegin, XEnd) 구간만 (Active tile) */
+	static void JacobiRowSpan(const float* Input, const float* Prev, float* Output, int32 Y, int32 XBegin, int32 XEnd, int32 Resolution, float Alpha, float InvBeta);
+	
+	/** FluidDiffuse.usf와 같은 Jacobi 반복 */
+	static void Jacobi(TArray<float>& Pressure, TConstArrayView<float> Divergence, int32 Resolution, int32 NumIterations);
+	
+	/**
+	 * FluidDiffuseTiled.usf의 tile 단위 계산을 그대로 재현 (8x8 tile + halo, dispatch당 IterationsPerDispatch 번 반복)
+	 * 같은 NumIterations의 Jacobi()와 결과가 일치해야 한다.
+	 */
+	static void JacobiTiled(TArray<float>& Pressure, TConstArrayView<float> Divergence, int32 Resolution, int32 NumIterations, int32 IterationsPerDispatch);
+	
+	/** FluidPressureRedBlack.usf와 같은 in-place Red-Black SOR (한 iteration = Red + Black sweep) */
+	static void RedBlackSOR(TArray<float>& Pressure, TConstArrayView<float> Divergence, int32 Resolution, int32 NumIterations, float Omega);
+	
+	/** AddPressureMultigridPasses와 같은 구성의 V-Cycle */
+	static void MultigridVCycle(TArray<float>& Pressure, TConstArrayView<float> Divergence, int32 Resolution, int32 NumVCycles, int32 NumSmoothIterations);
+	
+	/** r = b - Laplacian(p) */
+	static void ComputeResidual(TConstArrayView<float> Pressure, TConstArrayView<float> Rhs, int32 Resolution, float Dx, TArray<float>& OutResidual);
+	
+	/** GPU warm start와 같은 판정 기준: max|r| / max|b| */
+	static float ComputeRelativeResidual(TConstArrayView<float> Pressure, TConstArrayView<float> Divergence, int32 Resolution);
+	
+	/** Residual의 RMS (수렴 판정용) */
+	static float ComputeResidualNorm(TConstArrayView<float> Pressure, TConstArrayView<float> Divergence, int32 Resolution);
+};
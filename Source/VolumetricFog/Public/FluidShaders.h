@@ -5,9 +5,13 @@
 #include "ShaderParameterStruct.h"
 #include "RenderGraphUtils.h"
 
-#ifndef MAX_FLUID_INTERACTION_FORCE_SOURCE
-#define MAX_FLUID_INTERACTION_FORCE_SOURCE 8
-#endif
+/** Sparse Active Tile (FluidTiles.ush): 켜면 ActiveTileList의 tile만 indirect dispatch */
+class FFluidActiveTilesDim : SHADER_PERMUTATION_BOOL("FLUID_ACTIVE_TILES");
+
+BEGIN_SHADER_PARAMETER_STRUCT(FFluidActiveTileParameters, )
+	SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ActiveTileList)
+	RDG_BUFFER_ACCESS(ActiveTileIndirectArgs, ERHIAccess::IndirectArgs)
+END_SHADER_PARAMETER_STRUCT()
 
 
 class FFluidAdvectVelocityCS : public FGlobalShader
@@ -15,6 +19,8 @@ class FFluidAdvectVelocityCS : public FGlobalShader
 public:
 	DECLARE_GLOBAL_SHADER(FFluidAdvectVelocityCS);
 	SHADER_USE_PARAMETER_STRUCT(FFluidAdvectVelocityCS, FGlobalShader);
+	
+	using FPermutationDomain = TShaderPermutationDomain<FFluidActiveTilesDim>;
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 			SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, VelocityInput)
@@ -23,6 +29,7 @@ public:
 			SHADER_PARAMETER(float, DeltaTime)
 			SHADER_PARAMETER(FVector2f, InvResolution)
 			SHADER_PARAMETER(FIntPoint, Resolution)
+			SHADER_PARAMETER_STRUCT_INCLUDE(FFluidActiveTileParameters, Tiles)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -36,6 +43,8 @@ class FFluidAdvectCS : public FGlobalShader
 public:
 	DECLARE_GLOBAL_SHADER(FFluidAdvectCS);
 	SHADER_USE_PARAMETER_STRUCT(FFluidAdvectCS, FGlobalShader);
+	
+	using FPermutationDomain = TShaderPermutationDomain<FFluidActiveTilesDim>;
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, VelocityInput)
@@ -45,6 +54,60 @@ public:
 		SHADER_PARAMETER(float, DeltaTime)
 		SHADER_PARAMETER(FVector2f, InvResolution)
 		SHADER_PARAMETER(FIntPoint, Resolution)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFluidActiveTileParameters, Tiles)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+/** MacCormack 보정 (Density) */
+class FFluidMacCormackCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidMacCormackCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidMacCormackCS, FGlobalShader);
+	
+	using FPermutationDomain = TShaderPermutationDomain<FFluidActiveTilesDim>;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, VelocityInput)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, SourceInput)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, PredictedInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, Output)
+		SHADER_PARAMETER_SAMPLER(SamplerState, BilinearSampler)
+		SHADER_PARAMETER(float, DeltaTime)
+		SHADER_PARAMETER(FVector2f, InvResolution)
+		SHADER_PARAMETER(FIntPoint, Resolution)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFluidActiveTileParameters, Tiles)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+/** MacCormack 보정 (Velocity) */
+class FFluidMacCormackVelocityCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidMacCormackVelocityCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidMacCormackVelocityCS, FGlobalShader);
+	
+	using FPermutationDomain = TShaderPermutationDomain<FFluidActiveTilesDim>;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, VelocityInput)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, PredictedInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float2>, Output)
+		SHADER_PARAMETER_SAMPLER(SamplerState, BilinearSampler)
+		SHADER_PARAMETER(float, DeltaTime)
+		SHADER_PARAMETER(FVector2f, InvResolution)
+		SHADER_PARAMETER(FIntPoint, Resolution)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFluidActiveTileParameters, Tiles)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -84,11 +147,78 @@ public:
 	}
 }; 
 
+/** CPU Readback용 Density Box Downsample */
+class FFluidDensityDownsampleCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidDensityDownsampleCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidDensityDownsampleCS, FGlobalShader);
+	
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, DensityInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, DensityOutput)
+		SHADER_PARAMETER(uint32, DownsampleFactor)
+		SHADER_PARAMETER(FIntPoint, InputResolution)
+		SHADER_PARAMETER(FIntPoint, OutputResolution)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+/** Empty Space Skipping용 Density 최대값 Mip 한 단계 (Density → Mip 0, Mip N → Mip N+1) */
+class FFluidDensityMaxMipCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidDensityMaxMipCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidDensityMaxMipCS, FGlobalShader);
+	
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D<float>, MaxMipInput)
+		SHADER_PARAMETER_RDG_TEXTURE_SRV(Texture2D<float>, MaxMipHistoryInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, MaxMipOutput)
+		SHADER_PARAMETER(FIntPoint, InputResolution)
+		SHADER_PARAMETER(FIntPoint, OutputResolution)
+		SHADER_PARAMETER(uint32, bFromDensity)
+		SHADER_PARAMETER(uint32, bWithHistory)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+/** Simulation 해상도 LOD 변경 시 Velocity / Density bilinear 재샘플 */
+class FFluidResampleCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidResampleCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidResampleCS, FGlobalShader);
+	
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, ResampleInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, ResampleOutput)
+		SHADER_PARAMETER_SAMPLER(SamplerState, BilinearSampler)
+		SHADER_PARAMETER(FIntPoint, OutputResolution)
+		SHADER_PARAMETER(FVector4f, ValueScale)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
 class FFluidDiffuseCS : public FGlobalShader
 {
 public:
 	DECLARE_GLOBAL_SHADER(FFluidDiffuseCS);
 	SHADER_USE_PARAMETER_STRUCT(FFluidDiffuseCS, FGlobalShader);
+	
+	using FPermutationDomain = TShaderPermutationDomain<FFluidActiveTilesDim>;
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, InputTexture)
@@ -97,6 +227,236 @@ public:
 		SHADER_PARAMETER(float, Alpha)
 		SHADER_PARAMETER(float, InvBeta)
 		SHADER_PARAMETER(FIntPoint, Resolution)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFluidActiveTileParameters, Tiles)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+
+/** FFluidDiffuseCS를 groupshared tile에서 여러 번 반복 (dispatch 수 감소) */
+class FFluidDiffuseTiledCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidDiffuseTiledCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidDiffuseTiledCS, FGlobalShader);
+	
+	/** Dispatch 한 번에 수행하는 최대 반복 횟수 (= halo 크기) */
+	static constexpr int32 MaxIterationsPerDispatch = 4;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, InputTexture)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, PrevTexture)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, OutputTexture)
+		SHADER_PARAMETER(float, Alpha)
+		SHADER_PARAMETER(float, InvBeta)
+		SHADER_PARAMETER(FIntPoint, Resolution)
+		SHADER_PARAMETER(uint32, NumIterations)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+	
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("FUSED_JACOBI_MAX_ITERATIONS"), MaxIterationsPerDispatch);
+	}
+};
+
+/** Tile별 활성 여부 (Density / Velocity threshold, Interaction force 범위) */
+class FFluidTileClassifyCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidTileClassifyCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidTileClassifyCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, DensityInput)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, VelocityInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint>, TileMaskOutput)
+		SHADER_PARAMETER(float, DensityThreshold)
+		SHADER_PARAMETER(float, VelocityThresholdSquared)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ForceTileSourceOffsets)
+		SHADER_PARAMETER(FIntPoint, Resolution)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+/** Dilation + Active / Retired tile 목록 생성 */
+class FFluidTileCompactCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidTileCompactCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidTileCompactCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<uint>, TileMaskInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint>, PrevTileMask)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, ActiveTileListOutput)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, ActiveTileArgs)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWStructuredBuffer<uint>, RetiredTileListOutput)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, RetiredTileArgs)
+		SHADER_PARAMETER(FIntPoint, NumTiles)
+		SHADER_PARAMETER(int32, Dilation)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+/** Retired tile을 모든 시뮬레이션 texture에서 0으로 */
+class FFluidTileClearCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidTileClearCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidTileClearCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float2>, Velocity0)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float2>, Velocity1)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float2>, TempVelocity)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, Density0)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, Density1)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, Pressure0)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, Pressure1)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, Divergence)
+		SHADER_PARAMETER(FIntPoint, Resolution)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFluidActiveTileParameters, Tiles)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+/** Red-Black SOR Pressure Solver (in-place) */
+class FFluidPressureRedBlackCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidPressureRedBlackCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidPressureRedBlackCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, DivergenceInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, Pressure)
+		SHADER_PARAMETER(float, Alpha)
+		SHADER_PARAMETER(float, Omega)
+		SHADER_PARAMETER(uint32, Parity)
+		SHADER_PARAMETER(FIntPoint, Resolution)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+/** Multigrid Pressure Solver */
+class FFluidPressureSmoothCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidPressureSmoothCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidPressureSmoothCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, PressureInput)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, RhsInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, PressureOutput)
+		SHADER_PARAMETER(float, Alpha)
+		SHADER_PARAMETER(float, Weight)
+		SHADER_PARAMETER(FIntPoint, Resolution)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+class FFluidPressureResidualCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidPressureResidualCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidPressureResidualCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, PressureInput)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, RhsInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, ResidualOutput)
+		SHADER_PARAMETER(float, InvDxSquared)
+		SHADER_PARAMETER(FIntPoint, Resolution)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+class FFluidPressureResidualReduceCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidPressureResidualReduceCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidPressureResidualReduceCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, ResidualInput)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, RhsInput)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, ResidualMaxOutput)
+		SHADER_PARAMETER(FIntPoint, Resolution)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+class FFluidPressureRestrictCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidPressureRestrictCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidPressureRestrictCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, FineInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, CoarseOutput)
+		SHADER_PARAMETER(FIntPoint, FineResolution)
+		SHADER_PARAMETER(FIntPoint, CoarseResolution)
+	END_SHADER_PARAMETER_STRUCT()
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+class FFluidPressureProlongateCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFluidPressureProlongateCS);
+	SHADER_USE_PARAMETER_STRUCT(FFluidPressureProlongateCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, PressureInput)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, CorrectionInput)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, PressureOutput)
+		SHADER_PARAMETER_SAMPLER(SamplerState, BilinearSampler)
+		SHADER_PARAMETER(FVector2f, CoarseUVScale)
+		SHADER_PARAMETER(FIntPoint, Resolution)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -111,6 +471,8 @@ class FFluidDiffuseVelocityCS : public FGlobalShader
 public:
 	DECLARE_GLOBAL_SHADER(FFluidDiffuseVelocityCS);
 	SHADER_USE_PARAMETER_STRUCT(FFluidDiffuseVelocityCS, FGlobalShader);
+	
+	using FPermutationDomain = TShaderPermutationDomain<FFluidActiveTilesDim>;
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, InputTexture)
@@ -119,6 +481,7 @@ public:
 		SHADER_PARAMETER(float, Alpha)
 		SHADER_PARAMETER(float, InvBeta)
 		SHADER_PARAMETER(FIntPoint, Resolution)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFluidActiveTileParameters, Tiles)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -133,6 +496,8 @@ public:
 	
 	DECLARE_GLOBAL_SHADER(FFluidForceCS);
 	SHADER_USE_PARAMETER_STRUCT(FFluidForceCS, FGlobalShader);
+	
+	using FPermutationDomain = TShaderPermutationDomain<FFluidActiveTilesDim>;
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, DensityInput)
@@ -143,13 +508,15 @@ public:
 		SHADER_PARAMETER(float, DeltaTime)
 		SHADER_PARAMETER(float, Dissipation) 
 		
-		// Interaction Params
-		SHADER_PARAMETER(uint32, InteractionForceSourceCount) 
-		SHADER_PARAMETER_ARRAY(FVector4f, InteractionForcePositionRadius, [MAX_FLUID_INTERACTION_FORCE_SOURCE])
-		SHADER_PARAMETER_ARRAY(FVector4f, InteractionForceVectorDensity, [MAX_FLUID_INTERACTION_FORCE_SOURCE])
+		// Interaction Params (FFluidInteractionForceBins)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<FFluidInteractionForceSource>, InteractionForceSources)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ForceTileSourceOffsets)
+		SHADER_PARAMETER_RDG_BUFFER_SRV(StructuredBuffer<uint>, ForceTileSourceIndices)
+		SHADER_PARAMETER(uint32, NumForceTiles)
 	
 		SHADER_PARAMETER(FVector2f, InvResolution)
 		SHADER_PARAMETER(FIntPoint, Resolution)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFluidActiveTileParameters, Tiles)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -164,12 +531,15 @@ class FFluidDivergenceCS : public FGlobalShader
 public:
 	DECLARE_GLOBAL_SHADER(FFluidDivergenceCS);
 	SHADER_USE_PARAMETER_STRUCT(FFluidDivergenceCS, FGlobalShader);
+	
+	using FPermutationDomain = TShaderPermutationDomain<FFluidActiveTilesDim>;
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, VelocityInput)
 		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, DivergenceOutput)
 		SHADER_PARAMETER(FIntPoint, Resolution)
 		SHADER_PARAMETER(float, HalfInvDx)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFluidActiveTileParameters, Tiles)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -183,6 +553,8 @@ class FFluidGradientSubtractCS : public FGlobalShader
 public:
 	DECLARE_GLOBAL_SHADER(FFluidGradientSubtractCS);
 	SHADER_USE_PARAMETER_STRUCT(FFluidGradientSubtractCS, FGlobalShader);
+	
+	using FPermutationDomain = TShaderPermutationDomain<FFluidActiveTilesDim>;
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
 		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float2>, VelocityInput)
@@ -190,6 +562,7 @@ public:
 		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float2>, VelocityOutput)
 		SHADER_PARAMETER(FIntPoint, Resolution)
 		SHADER_PARAMETER(float, HalfInvDx)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFluidActiveTileParameters, Tiles)
 	END_SHADER_PARAMETER_STRUCT()
 
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FluidSimulationComponent.h"
+#include "Async/TaskGraphInterfaces.h"
+
+/**
+ * UFluidSimulationComponent::AddSimulationPasses와 같은 Stable Fluids 파이프라인의 CPU 구현
+ * (Advect Velocity → Viscosity → Force → Divergence → Pressure → Gradient Subtract → Advect Density → Density Maintenance)
+ *
+ * GPU가 없는 환경(Build Agent, Dedicated Server)에서의 검증/Fallback 및 GPU 최적화의 비교 기준으로 사용한다.
+ * 모든 Grid는 SoA, Resolution x Resolution, row-major (Index = Y * Resolution + X)
+ */
+class VOLUMETRICFOG_API FFluidSimulationCPU
+{
+public:
+	void Init(int32 InResolution);
+	
+	/** 한 스텝 진행 (SimParams.BaseDensityNoiseTexture 대신 SetBaseDensityNoise로 넘긴 값을 사용) */
+	void Step(const FFluidSimulationParams& SimParams);
+	
+	/** Density Maintenance에 쓰는 Noise (R 채널, 0~1), Mirror로 sampling */
+	void SetBaseDensityNoise(TArray<float> InValues, int32 InWidth, int32 InHeight);
+	
+	/** 초기 Density (Resolution x Resolution, row-major), 16-bit면 저장할 때처럼 반올림 */
+	void SetDensity(TArray<float> InValues);
+	
+	/** GPU Bilinear/Clamp Sampler와 같은 방식의 sampling (UV = 0~1) */
+	float SampleDensity(const FVector2f& UV) const;
+	
+	/** 고정 Velocity(cell/s)로 scalar field를 한 번 advect (FluidAdvect.usf, MacCormack이면 FluidMacCormack.usf 보정까지) */
+	static void AdvectScalarField(TConstArrayView<float> Source, TArray<float>& Output, TConstArrayView<float> InVelocityX,
+		TConstArrayView<float> InVelocityY, int32 InResolution, float DeltaTime, EFluidAdvectionMode AdvectionMode);
+	
+	/** Force pass만 한 번 (FFluidInteractionForceBins::Build + FluidForce.usf, Velocity에 Force * DeltaTime 누적) */
+	void ApplyInteractionForces(const FFluidSimulationParams& SimParams);
+	
+	/** FluidForceSources.ush GetFluidForceSourceDistanceSquared (Radius로 나눈 UV 거리, swept source는 선분까지) */
+	static float GetForceSourceDistanceSquared(const FFluidInteractionForceSource& Source, const FVector2f& UV);
+	
+	/** 16-bit 성분은 GPU texture에 저장될 때처럼 pass 출력마다 반올림 (기본값은 모두 32-bit) */
+	void SetPrecision(const FFluidSimulationPrecision& InPrecision) { Precision = InPrecision; }
+	
+	int32 GetResolution() const { return Resolution; }
+	TConstArrayView<float> GetDensity() const { return Density; }
+	TConstArrayView<float> GetVelocityX() const { return VelocityX; }
+	TConstArrayView<float> GetVelocityY() const { return VelocityY; }
+	TConstArrayView<float> GetPressure() const { return Pressure; }
+	TConstArrayView<float> GetDivergence() const { return Divergence; }
+	
+	/** 마지막 Step / ApplyInteractionForces의 tile binning */
+	const FFluidInteractionForceBins& GetForceBins() const { return ForceBins; }
+	
+	/** 마지막 Step에서 시뮬레이션한 tile 비율 (bActiveTiles가 꺼져 있으면 1) */
+	float GetLastActiveTileFraction() const { return LastActiveTileFraction; }
+	
+private:
+	/** AddActiveTilePasses와 같은 분류 / dilation / retire 규칙 */
+	void BuildActiveTiles(const FFluidSimulationParams& SimParams);
+	
+	/** 활성 tile이 덮는 row 구간마다 RowFunc(Y, XBegin, XEnd) (bActiveTiles가 꺼져 있으면 전체 row) */
+	template<typename RowFuncType>
+	void ForEachActiveRow(RowFuncType&& RowFunc) const;
+	
+	void AdvectVelocity(float DeltaTime, bool bMacCormack);
+	void DiffuseVelocity(float DeltaTime, float Viscosity);
+	void ApplyForce(const FFluidSimulationParams& SimParams);
+	void ComputeDivergence();
+	void SolvePressure(const FFluidSimulationParams& SimParams);
+	void SubtractGradient();
+	void AdvectDensity(float DeltaTime, bool bMacCormack);
+	void MaintainDensity(const FFluidSimulationParams& SimParams);
+	
+	int32 Resolution = 0;
+	FFluidSimulationPrecision Precision;
+	
+	TArray<float> VelocityX;
+	TArray<float> VelocityY;
+	TArray<float> VelocityScratchX;
+	TArray<float> VelocityScratchY;
+	TArray<float> TempVelocityX;
+	TArray<float> TempVelocityY;
+	
+	TArray<float> Density;
+	TArray<float> DensityScratch;
+	TArray<float> DensityPredicted;
+	
+	TArray<float> Pressure;
+	TArray<float> PressureScratch;
+	TArray<float> Divergence;
+	
+	TArray<float> BaseDensityNoise;
+	int32 BaseDensityNoiseWidth = 0;
+	int32 BaseDensityNoiseHeight = 0;
+	
+	bool bBaseDensityInitialized = false;
+	
+	/** Warm start (GPU FFluidResources와 같은 정책, residual은 readback 없이 바로 계산) */
+	bool bPressureHistoryValid = false;
+	int32 AdaptivePressureIterations = 0;
+	float LastPressureResidual = -1.0f;
+	
+	/** Interaction force tile binning (GPU와 같은 layout) */
+	FFluidInteractionForceBins ForceBins;
+	
+	/** Sparse Active Tile (FluidActiveTiles::TileSize 단위) */
+	bool bActiveTilesThisStep = false;
+	bool bTileMaskValid = false;
+	TArray<uint8> PrevTileMask;
+	/** Tile row마다 활성 구간 [X, Y) (셀 단위, 인접 tile은 합침) */
+	TArray<TArray<FIntPoint>> ActiveTileSpans;
+	float LastActiveTileFraction = 1.0f;
+};
+
+/**
+ * 시뮬레이션 Density의 CPU 사본 (Gameplay query용)
+ * Publish/Sample 모두 어느 thread에서나 호출 가능
+ */
+class VOLUMETRICFOG_API FFluidDensitySnapshot
+{
+public:
+	/** Values: Resolution x Resolution, row-major (UV는 FFluidInteractionTracker::BuildSources와 같은 방향) */
+	void Publish(TArray<float> InValues, int32 InResolution, const FVector& InBoundsOrigin, const FVector& InBoundsExtent);
+	
+	/** Bounds 밖이면 0, 높이 감쇠가 적용되지 않은 raw density */
+	float SampleAtWorldLocation(const FVector& WorldLocation) const;
+	
+	bool IsValid() const;
+	
+private:
+	mutable FRWLock Lock;
+	TArray<float> Values;
+	int32 Resolution = 0;
+	FVector BoundsOrigin = FVector::ZeroVector;
+	FVector BoundsExtent = FVector::ZeroVector;
+};
+
+/**
+ * FFluidSimulationCPU를 worker thread에서 한 스텝씩 진행하고 결과 Density를 FFluidDensitySnapshot으로 공개
+ * (Dedicated Server / NullRHI 용). Kick/IsStepInFlight는 Game thread에서만 호출
+ */
+class VOLUMETRICFOG_API FFluidSimulationCPUWorker : public TSharedFromThis<FFluidSimulationCPUWorker, ESPMode::ThreadSafe>
+{
+public:
+	explicit FFluidSimulationCPUWorker(TSharedRef<FFluidDensitySnapshot, ESPMode::ThreadSafe> InOutput);
+	
+	void Init(int32 InResolution, TArray<float> BaseDensityNoise, int32 NoiseWidth, int32 NoiseHeight);
+	
+	bool IsStepInFlight() const;
+	
+	/**
+	 * 이전 스텝이 끝난 뒤에만 호출 (IsStepInFlight() == false)
+	 * InteractionSources가 있으면 BuildTask 완료 후 그 Source로 진행
+	 */
+	void KickStep(FFluidSimulationParams SimParams, const FVector& BoundsOrigin, const FVector& BoundsExtent,
+		TSharedPtr<FFluidInteractionSourceSlot, ESPMode::ThreadSafe> InteractionSources = nullptr);
+	
+	void WaitForCompletion();
+	
+	int32 GetResolution() const { return Simulation.GetResolution(); }
+	
+private:
+	FFluidSimulationCPU Simulation;
+	TSharedRef<FFluidDensitySnapshot, ESPMode::ThreadSafe> Output;
+	FGraphEventRef StepTask;
+};
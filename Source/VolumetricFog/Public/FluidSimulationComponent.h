@@ -4,11 +4,11 @@
 #include "Components/ActorComponent.h"
 #include "Engine/Texture2D.h"
 #include "FogSceneViewExtension.h"
+#include "RHIGPUReadback.h"
+#include <atomic>
 #include "FluidSimulationComponent.generated.h"
 
-#ifndef MAX_FLUID_INTERACTION_FORCE_SOURCE
-#define MAX_FLUID_INTERACTION_FORCE_SOURCE 8
-#endif
+DECLARE_STATS_GROUP(TEXT("VolumetricFog"), STATGROUP_VolumetricFog, STATCAT_Advanced);
 
 class UCurveFloat;
 class ADirectionalLight;
@@ -16,6 +16,44 @@ class ULightComponent;
 class UPrimitiveComponent; 
 
 class FRDGBuilder;
+class FFluidSimulationCPUWorker;
+class FFluidInteractionTracker;
+struct FFluidInteractionSourceSlot;
+class FFluidDensitySnapshot;
+namespace FluidSimulationComponent { struct FInteractionForceBinBuffers; }
+
+UENUM(BlueprintType)
+enum class EFluidTexturePrecision : uint8
+{
+	Full UMETA(DisplayName = "32-bit Float"),
+	Half UMETA(DisplayName = "16-bit Float"),
+};
+
+/** 시뮬레이션 texture 정밀도 (성분별) */
+struct FFluidSimulationPrecision
+{
+	/** Velocity, TempVelocity */
+	EFluidTexturePrecision Velocity = EFluidTexturePrecision::Full;
+	EFluidTexturePrecision Density = EFluidTexturePrecision::Full;
+	/** Pressure, Divergence (Multigrid coarse level은 항상 32-bit) */
+	EFluidTexturePrecision Pressure = EFluidTexturePrecision::Full;
+	
+	/** Velocity / Density / Pressure + Divergence의 한 셀당 byte 수 (ping-pong 포함, Dense step의 Divergence / TempVelocity는 frame graph transient) */
+	int32 GetBytesPerCell(bool bInPlacePressure) const;
+};
+
+namespace FluidActiveTiles
+{
+	/** FluidTiles.ush의 FLUID_TILE_SIZE와 같아야 함 */
+	constexpr int32 TileSize = 8;
+}
+
+/** Interaction force source의 tile binning (FluidActiveTiles::TileSize 단위 tile) */
+namespace FluidInteractionForceBins
+{
+	/** FLUID_FORCE_CUTOFF_SQUARED: (거리 / Radius)^2, 4 sigma 밖(exp(-8) 미만)은 무시 */
+	constexpr float CutoffSquared = 16.0f;
+}
 
 // 시뮬레이션에 필요한 RTs
 struct FFluidResources
@@ -23,27 +61,96 @@ struct FFluidResources
 	FTextureRHIRef Velocity[2];
 	FTextureRHIRef Density[2];
 	FTextureRHIRef Pressure[2];
-	FTextureRHIRef Divergence; 
-	FTextureRHIRef Vorticity;
-	FTextureRHIRef TempVelocity; 
 
 	/** Cached Texture */
 	TRefCountPtr<IPooledRenderTarget> VelocityPooledRT[2];
 	TRefCountPtr<IPooledRenderTarget> DensityPooledRT[2];
 	TRefCountPtr<IPooledRenderTarget> PressurePooledRT[2];
+	/** Active tile step에서만 persistent (비활성 tile의 0 유지), Dense step은 frame graph의 transient texture */
 	TRefCountPtr<IPooledRenderTarget> DivergencePooledRT;
-	TRefCountPtr<IPooledRenderTarget> VorticityPooledRT;
 	TRefCountPtr<IPooledRenderTarget> TempVelocityPooledRT; 
+	
+	/** Sparse Active Tile: 이전 프레임의 활성 tile mask (R32_UINT, tile 단위) */
+	FTextureRHIRef TileMask;
+	TRefCountPtr<IPooledRenderTarget> TileMaskPooledRT;
+	/** false면 다음 tiled 프레임에서 모든 비활성 tile을 0으로 정리 */
+	bool bTileMaskValid = false;
     
 	int32 Resolution = 0;
+	FFluidSimulationPrecision Precision;
 	bool bInitialize = false;
+	/** Red-Black SOR는 Pressure를 in-place로 갱신하므로 Pressure[1]을 만들지 않음 */
+	bool bInPlacePressure = false;
 	bool bBaseDensityInitialized = false;
 
 	int32 VelocityIndex = 0;
 	int32 DensityIndex = 0;
 	int32 PressureIndex = 0; 
 	
-	void Init(int32 Res, FRHICommandListImmediate& RHICmdList);
+	/** Warm start: 이전 프레임 Pressure를 초기값으로 쓸 수 있는지 */
+	bool bPressureHistoryValid = false;
+	
+	/** Residual Readback (GPU를 기다리지 않도록 N 프레임 지연) */
+	static constexpr int32 NumPressureResidualReadbacks = 3;
+	TUniquePtr<FRHIGPUBufferReadback> PressureResidualReadbacks[NumPressureResidualReadbacks];
+	int32 PressureResidualWriteIndex = 0;
+	int32 PressureResidualPendingCount = 0;
+	
+	/** 마지막으로 읽은 상대 residual(max|r| / max|b|)로 조정된 반복 횟수 (0 = 미정) */
+	int32 AdaptivePressureIterations = 0;
+	
+	/** Density Readback (Gameplay query용, N 프레임 지연) */
+	struct FDensityReadbackRequest
+	{
+		int32 Resolution = 0;
+		FVector BoundsOrigin = FVector::ZeroVector;
+		FVector BoundsExtent = FVector::ZeroVector;
+	};
+	static constexpr int32 NumDensityReadbacks = 3;
+	TUniquePtr<FRHIGPUTextureReadback> DensityReadbacks[NumDensityReadbacks];
+	FDensityReadbackRequest DensityReadbackRequests[NumDensityReadbacks];
+	int32 DensityReadbackWriteIndex = 0;
+	int32 DensityReadbackPendingCount = 0;
+	
+	/** 완료된 Density Readback을 게시할 곳 (Game thread와 공유) */
+	TSharedPtr<FFluidDensitySnapshot, ESPMode::ThreadSafe> DensitySnapshot;
+	
+	/** Empty Space Skipping용 Density 최대값 Mip (Simulation step마다 갱신, Fog Ray March에서 사용) */
+	TRefCountPtr<IPooledRenderTarget> DensityMaxMipPooledRT;
+	
+	/** Interpolated timestep: 마지막 substep 직전 Density (렌더링이 두 step 사이를 보간), 다른 mode에서는 해제 */
+	TRefCountPtr<IPooledRenderTarget> DensityHistoryPooledRT;
+	
+	/** Simulation step GPU 시간 (VFF_FluidSimulation 구간 timestamp, N 프레임 지연) */
+	static constexpr int32 NumGPUTimers = 3;
+	FRenderQueryRHIRef GPUTimerBegin[NumGPUTimers];
+	FRenderQueryRHIRef GPUTimerEnd[NumGPUTimers];
+	int32 GPUTimerResolutions[NumGPUTimers] = {};
+	/** 한 구간에 기록된 substep 수 (step당 시간으로 환산) */
+	int32 GPUTimerSubsteps[NumGPUTimers] = {};
+	int32 GPUTimerWriteIndex = 0;
+	int32 GPUTimerPendingCount = 0;
+	bool bGPUTimerActive = false;
+	
+	/** 100만 셀당 step GPU 시간 (ms, 지수 평균, 0 = 측정 전), Game thread에서 읽음 (UFluidFogSubsystem 예산) */
+	std::atomic<float> GPUMillisecondsPerMegaCell { 0.0f };
+	
+	void Init(int32 Res, bool bInInPlacePressure, const FFluidSimulationPrecision& InPrecision, FRHICommandListImmediate& RHICmdList);
+	
+	/** 해상도 LOD 변경: 새 해상도로 다시 만들고 현재 Velocity / Density를 재샘플 */
+	void Resize(int32 NewRes, FRHICommandListImmediate& RHICmdList);
+	
+	/** Graph 실행 시점에 timestamp 기록 (AddSimulationFramePasses의 pass 안에서 호출) */
+	void BeginGPUTimer(FRHICommandListImmediate& RHICmdList);
+	void EndGPUTimer(FRHICommandListImmediate& RHICmdList, int32 NumSubsteps);
+	/** 준비된 timestamp를 GPUMillisecondsPerMegaCell에 반영 */
+	void PollGPUTimer();
+	
+	/** 준비된 Residual Readback 중 가장 최근 값 반환 (없으면 false) */
+	bool PollPressureResidual(float& OutRelativeResidual);
+	
+	/** 준비된 Density Readback을 DensitySnapshot에 게시 */
+	void PollDensityReadback();
 };
 
 UENUM(BlueprintType)
@@ -54,6 +161,23 @@ enum class EFluidFogDebugMode: uint8
 	DebugSelfShadow UMETA(DisplayName = "Debug Self Shadow")
 };
 
+UENUM(BlueprintType)
+enum class EFluidFogResolution : uint8
+{
+	Full UMETA(DisplayName = "Full"),
+	Half UMETA(DisplayName = "Half (1/4 Pixels)"),
+	Quarter UMETA(DisplayName = "Quarter (1/16 Pixels)"),
+};
+
+UENUM(BlueprintType)
+enum class EFluidFogRenderMode : uint8
+{
+	/** 픽셀마다 Simulation Box를 ray march (해상도에 비례) */
+	RayMarch UMETA(DisplayName = "Per-Pixel Ray March"),
+	/** 카메라 정렬 Froxel grid에 inject → 적분 → 픽셀당 lookup (Temporal Reprojection) */
+	Froxel UMETA(DisplayName = "Froxel"),
+};
+
 UENUM(BlueprintType)
 enum class EFluidHeightAttenuationMode : uint8
 {
@@ -62,17 +186,114 @@ enum class EFluidHeightAttenuationMode : uint8
 	CurveAttenuation UMETA(DisplayName = "Curve Attenuation"),
 };
 
+UENUM(BlueprintType)
+enum class EFluidPressureSolverMode : uint8
+{
+	Jacobi UMETA(DisplayName = "Jacobi"),
+	Multigrid UMETA(DisplayName = "Multigrid V-Cycle"),
+	RedBlackSOR UMETA(DisplayName = "Red-Black SOR"),
+	FusedJacobi UMETA(DisplayName = "Fused Jacobi (Tiled)"),
+};
+
+UENUM(BlueprintType)
+enum class EFluidAdvectionMode : uint8
+{
+	SemiLagrangian UMETA(DisplayName = "Semi-Lagrangian"),
+	/** 2차 정확도, 같은 해상도에서 덜 번짐 (advection pass가 2배) */
+	MacCormack UMETA(DisplayName = "MacCormack (Limited)"),
+};
+
+UENUM(BlueprintType)
+enum class EFluidSimulationTimestepMode : uint8
+{
+	/** 프레임 DeltaTime으로 한 step (hitch 때 CFL을 넘는 큰 step, 높은 FPS에서는 매 프레임 step) */
+	Variable UMETA(DisplayName = "Variable (Frame DeltaTime)"),
+	/** SimulationRate 간격의 고정 step, 프레임 시간을 누적해 프레임당 MaxSubsteps까지 */
+	Fixed UMETA(DisplayName = "Fixed Substeps"),
+	/** Fixed + 렌더링은 마지막 두 step의 Density를 보간 (SimulationRate를 30Hz 정도로 낮춰 프레임을 건너뜀) */
+	Interpolated UMETA(DisplayName = "Fixed + Interpolated (Skip Frames)"),
+};
+
+/** FluidForceSources.ush FFluidForceSource와 같은 layout (StructuredBuffer element) */
 struct FFluidInteractionForceSource
 {
 	FVector4f PositionRadius = FVector4f(0.0f, 0.0f, 1.0f, 1.0f);
 	FVector4f ForceDensity = FVector4f(0.0f, 0.0f, 0.0f, 1.0f);
+	/** xy = 이번 스텝 시작 위치 - PositionRadius.xy (UV), 0이면 점 source */
+	FVector4f SweepOffset = FVector4f(0.0f, 0.0f, 0.0f, 0.0f);
 };
 
-struct FTrackedFluidInteractionActor
+/**
+ * Tile마다 영향 범위(FluidInteractionForceBins::CutoffSquared)가 걸치는 source index (FluidForce.usf에 그대로 upload)
+ * 크기는 tile 수 + 모든 source가 걸치는 tile 수의 합
+ */
+struct VOLUMETRICFOG_API FFluidInteractionForceBins
 {
-	TWeakObjectPtr<AActor> InteractionActor;
-	TWeakObjectPtr<UPrimitiveComponent> Comp;
-	FVector LastLocation = FVector::ZeroVector; 
+	int32 NumTiles = 0;
+	/** Tile T의 source = SourceIndices[TileSourceOffsets[T], TileSourceOffsets[T + 1]) (NumTiles² + 1 개) */
+	TArray<uint32> TileSourceOffsets;
+	/** Tile 순서, tile 안에서는 source 순서 (FluidForce.usf의 합산 순서가 프레임마다 같음) */
+	TArray<uint32> SourceIndices;
+	
+	/** Source마다 cutoff 반경의 bounding box 안 tile만 검사 (비용은 source footprint의 합에 비례) */
+	void Build(TConstArrayView<FFluidInteractionForceSource> Sources, int32 Resolution);
+	
+	int32 GetTileSourceCount(int32 TileIndex) const { return TileSourceOffsets[TileIndex + 1] - TileSourceOffsets[TileIndex]; }
+};
+
+/** Game thread에서 캡처한 시뮬레이션 인자들 (Render thread 전달용 스냅샷) */
+struct FFluidSimulationParams
+{
+	float DeltaTime = 0.0f;
+	
+	float Dissipation = 0.993f;
+	float VorticityStrength = 5.0f;
+	float Viscosity = 0.001f;
+	EFluidAdvectionMode AdvectionMode = EFluidAdvectionMode::SemiLagrangian;
+	
+	// Pressure Solve
+	EFluidPressureSolverMode PressureSolverMode = EFluidPressureSolverMode::Jacobi;
+	int32 PressureIterations = 20;
+	int32 MultigridVCycles = 2;
+	int32 MultigridSmoothIterations = 2;
+	float SOROmega = 1.7f;
+	
+	bool bPressureWarmStart = false;
+	float PressureResidualTolerance = 0.01f;
+	int32 MinPressureIterations = 2;
+	
+	// Fog Generation Use Noise
+	bool bEnableDensityMaintenance = true;
+	FTextureRHIRef BaseDensityNoiseTexture;
+	float BaseDensityTarget = 500.0f;
+	float BaseDensityRecoverySpeed = 0.4f;
+	float BaseDensityDeadbandRatio = 0.8f;
+	float BaseDensityNoiseRepeat = 1.0f;
+	
+	// Interaction Force
+	TArray<FFluidInteractionForceSource> InteractionForceSources;
+	
+	// Sparse Active Tile
+	bool bActiveTiles = false;
+	float ActiveTileDensityThreshold = 0.01f;
+	float ActiveTileVelocityThreshold = 0.01f;
+	int32 ActiveTileDilation = 1;
+	
+	// Substep (AddSimulationFramePasses가 설정, 중간 substep은 readback / 최대값 Mip 생략)
+	bool bFinalSubstep = true;
+	/** 마지막 substep 직전 Density를 FFluidResources::DensityHistoryPooledRT로 보관 (Interpolated timestep) */
+	bool bDensityHistory = false;
+	
+	// Density Readback
+	bool bDensityReadback = false;
+	int32 DensityReadbackDownsample = 4;
+	
+	// Empty Space Skipping (Density 최대값 Mip)
+	bool bDensityMaxMip = false;
+	int32 DensityMaxMipCellSize = 8;
+	
+	FVector SimulationBoundsOrigin = FVector::ZeroVector;
+	FVector SimulationBoundsExtent = FVector::ZeroVector;
 };
 
 UCLASS(ClassGroup=(VolumetricFog), meta=(BlueprintSpawnableComponent))
@@ -86,6 +307,33 @@ public:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	
+	/**
+	 * CPU 시뮬레이션 결과 또는 GPU Density Readback(bEnableDensityReadback)의 density
+	 * BeginPlay ~ EndPlay 사이 어느 thread에서나 호출 가능, 결과가 없으면 0
+	 */
+	float SampleDensityAtWorldLocation(const FVector& WorldLocation) const;
+	
+	/** WorldLocation의 fog density (높이 감쇠 전, 몇 프레임 지연된 값) */
+	UFUNCTION(BlueprintCallable, Category = "Fog|Query")
+	float GetFogDensityAtLocation(const FVector& WorldLocation) const;
+	
+	bool IsUsingCPUSimulation() const { return CPUSimulation.IsValid(); }
+	
+	/**
+	 * DeltaTime만큼 Simulation 진행 (UFluidFogSubsystem이 schedule, Subsystem이 없으면 TickComponent에서 매 프레임)
+	 * Fixed / Interpolated timestep은 고정 step 0~MaxSubsteps번을 한 graph로, MinStepInterval(LOD tick 간격)보다 짧은 step은 쓰지 않음
+	 */
+	void StepSimulation(float DeltaTime, float MinStepInterval = 0.0f);
+	
+	/** StepSimulation(DeltaTime, MinStepInterval)이 실행할 step 수 (Subsystem GPU 예산용, 상태는 바꾸지 않음) */
+	int32 PredictSimulationSubsteps(float DeltaTime, float MinStepInterval = 0.0f) const;
+	
+	/** GPU Simulation 해상도 LOD (SimResolution 이하, 바뀌면 Render thread에서 재샘플) */
+	void SetSimulationLODResolution(int32 InResolution);
+	
+	/** Resolution x Resolution 한 step의 GPU 시간 추정 (측정 전이면 기본값) */
+	float EstimateSimulationGPUMilliseconds(int32 Resolution) const;
 
 	// ======== Debug Setting ======== 
 	UPROPERTY(EditAnyWhere, BlueprintReadWrite, Category="Fluid|Debug")
@@ -100,9 +348,78 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation", meta = (ClampMin = "16", ClampMax = "2048"))
 	int32 SimResolution = 1024;
 	
+	/** UFluidFogSubsystem이 화면 크기 / 거리에 따라 해상도와 tick 빈도를 낮춤 (끄면 항상 SimResolution으로 매 프레임) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation|LOD")
+	bool bEnableSimulationLOD = true;
+	
+	/** 해상도 LOD의 최소값 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation|LOD", meta = (ClampMin = "16", ClampMax = "2048", EditCondition = "bEnableSimulationLOD"))
+	int32 MinLODSimResolution = 128;
+	
+	/** Fixed / Interpolated면 Simulation 비용이 렌더 프레임레이트와 무관 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation|Timestep")
+	EFluidSimulationTimestepMode TimestepMode = EFluidSimulationTimestepMode::Fixed;
+	
+	/** 고정 step 빈도 (Hz), Interpolated는 30 정도면 충분 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation|Timestep", meta = (ClampMin = "10.0", ClampMax = "240.0", EditCondition = "TimestepMode != EFluidSimulationTimestepMode::Variable"))
+	float SimulationRate = 60.0f;
+	
+	/** 한 프레임의 최대 step 수 (넘는 시간은 버림, hitch 후 step이 몰리지 않도록) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation|Timestep", meta = (ClampMin = "1", ClampMax = "8", EditCondition = "TimestepMode != EFluidSimulationTimestepMode::Variable"))
+	int32 MaxSubsteps = 4;
+	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation", meta = (ClampMin = "0.9", ClampMax = "1.0"))
 	float Dissipation = 0.993f;
 	
+	/** MacCormack은 낮은 SimResolution에서도 detail이 유지됨 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation")
+	EFluidAdvectionMode AdvectionMode = EFluidAdvectionMode::SemiLagrangian;
+	
+	/** GPU 대신 CPU(worker thread)에서 시뮬레이션 (NullRHI / Dedicated Server에서는 자동으로 사용) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation")
+	bool bForceCPUSimulation = false;
+	
+	/** CPU 시뮬레이션 해상도 (server tick 비용을 고려해 낮게 유지) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation", meta = (ClampMin = "16", ClampMax = "128"))
+	int32 CPUSimResolution = 64;
+	
+	/** 16-bit면 Velocity / TempVelocity 메모리 절반 (BeginPlay에서 적용) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation|Precision")
+	EFluidTexturePrecision VelocityPrecision = EFluidTexturePrecision::Full;
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation|Precision")
+	EFluidTexturePrecision DensityPrecision = EFluidTexturePrecision::Full;
+	
+	/** Pressure 값은 dx² 단위로 작아 16-bit 반올림에 민감함, Jacobi에서는 drift가 작지만 Multigrid / RedBlackSOR에서는 커짐 (VolumetricFog.Simulation.PrecisionDrift) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation|Precision")
+	EFluidTexturePrecision PressurePrecision = EFluidTexturePrecision::Full;
+	
+	/**
+	 * Density / Velocity가 threshold 이하인 8x8 tile은 시뮬레이션하지 않음 (Indirect dispatch)
+	 * Density Maintenance가 켜져 있으면 모든 tile에 fog가 유지되므로 무시됨
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation")
+	bool bEnableActiveTiles = false;
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation", meta = (ClampMin = "0.0", EditCondition = "bEnableActiveTiles"))
+	float ActiveTileDensityThreshold = 0.01f;
+	
+	/** 셀/초 단위 속도 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation", meta = (ClampMin = "0.0", EditCondition = "bEnableActiveTiles"))
+	float ActiveTileVelocityThreshold = 0.01f;
+	
+	/** 활성 tile 주변으로 확장할 tile 수 (한 프레임에 fog가 이동할 수 있는 거리 이상) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Simulation", meta = (ClampMin = "0", ClampMax = "4", EditCondition = "bEnableActiveTiles"))
+	int32 ActiveTileDilation = 1;
+	
+	/** GPU Density를 비동기로 읽어와 GetFogDensityAtLocation에서 사용 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Query")
+	bool bEnableDensityReadback = false;
+	
+	/** Readback 전에 Density를 이 배수만큼 축소 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Query", meta = (ClampMin = "1", ClampMax = "16", EditCondition = "bEnableDensityReadback"))
+	int32 DensityReadbackDownsample = 4;
+	
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Density", meta =
 	(ClampMin = "0.0"))
 	float FogDensityMultiplier = 30.f;
@@ -122,6 +439,41 @@ public:
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering")
 	float MaxRayDistance = 5000.f;
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering")
+	EFluidFogRenderMode FogRenderMode = EFluidFogRenderMode::RayMarch;
+	
+	/** Ray March 해상도 (Half/Quarter는 Scene Depth 기준 Bilateral Upsample로 합성) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering", meta = (EditCondition = "FogRenderMode == EFluidFogRenderMode::RayMarch"))
+	EFluidFogResolution RayMarchResolution = EFluidFogResolution::Full;
+	
+	/** Upsample 시 같은 surface로 볼 depth 차이 (픽셀 depth 대비 비율), 작을수록 geometry 경계가 선명 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering", meta = (EditCondition = "RayMarchResolution != EFluidFogResolution::Full", ClampMin = "0.001", ClampMax = "1.0"))
+	float UpsampleDepthTolerance = 0.05f;
+	
+	/** 프레임마다 ray 시작 위치를 jitter하고 이전 프레임 결과(Depth reprojection + 이웃 clamp)와 누적, NumSteps를 12~16으로 낮춰도 banding이 없음 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering", meta = (EditCondition = "FogRenderMode == EFluidFogRenderMode::RayMarch"))
+	bool bTemporalRayMarch = false;
+	
+	/** 이전 프레임 비중 (클수록 부드럽지만 Fog가 빠르게 움직이면 잔상) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering", meta = (EditCondition = "bTemporalRayMarch", ClampMin = "0.0", ClampMax = "0.98"))
+	float TemporalHistoryWeight = 0.9f;
+	
+	/** X, Y = 화면 분할, Z = MaxRayDistance까지의 depth slice (DebugSelfShadow 모드는 지원하지 않음) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering|Froxel", meta = (EditCondition = "FogRenderMode == EFluidFogRenderMode::Froxel"))
+	FIntVector FroxelGridSize = FIntVector(160, 90, 64);
+	
+	/** 이전 프레임 Froxel 비중 (0 = Temporal 누적 없음) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering|Froxel", meta = (EditCondition = "FogRenderMode == EFluidFogRenderMode::Froxel", ClampMin = "0.0", ClampMax = "0.98"))
+	float FroxelHistoryWeight = 0.9f;
+	
+	/** Density 최대값 Mip으로 Fog가 없는 구간의 Ray March step을 건너뜀 (결과는 같음) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering", meta = (EditCondition = "FogRenderMode == EFluidFogRenderMode::RayMarch"))
+	bool bEmptySpaceSkipping = true;
+	
+	/** 최대값 Mip 0의 Cell 하나가 덮는 Density texel 수 (작을수록 촘촘히 건너뛰지만 Mip 조회가 늘어남) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering", meta = (EditCondition = "bEmptySpaceSkipping", ClampMin = "2", ClampMax = "64"))
+	int32 EmptySpaceSkipCellSize = 8;
  
 	/** Fog Rendering using Directional Light */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering")
@@ -146,6 +498,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering|SelfShadow", meta = (ClampMin = "1", ClampMax = "64"))
 	int32 SelfShadowStepCount = 15;
 	
+	/** Light 방향 Optical Depth를 Simulation tick마다 3D volume에 bake하고 ray march는 sample마다 한 번 lookup (끄면 sample마다 SelfShadowStepCount 만큼 ray march) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering|SelfShadow")
+	bool bUseShadowVolume = true;
+	
+	/** Shadow Volume XY 해상도 (Simulation Box 전체) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering|SelfShadow", meta = (EditCondition = "bUseShadowVolume", ClampMin = "4", ClampMax = "256"))
+	int32 ShadowVolumeResolutionXY = 64;
+	
+	/** Shadow Volume Z 해상도 (FogBaseHeight ~ FogMaxHeight) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering|SelfShadow", meta = (EditCondition = "bUseShadowVolume", ClampMin = "4", ClampMax = "128"))
+	int32 ShadowVolumeResolutionZ = 32;
+	
 	//UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fog|Rendering|SelfShadow", meta = (ClampMin = "0.0", ClampMax = "2000.0"))
 	float SelfShadowMaxDistance = 2000.0f;
 	
@@ -154,6 +518,33 @@ public:
 	int32 PressureIterations = 20;
 	float Viscosity = 0.001f;
 	
+	/** Pressure Solver Params */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Pressure")
+	EFluidPressureSolverMode PressureSolverMode = EFluidPressureSolverMode::Jacobi;
+	
+	/** Multigrid: 프레임당 V-Cycle 횟수 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Pressure", meta = (ClampMin = "1", ClampMax = "8", EditCondition = "PressureSolverMode == EFluidPressureSolverMode::Multigrid"))
+	int32 MultigridVCycles = 2;
+	
+	/** Multigrid: 각 level에서 restriction 전/prolongation 후 smoothing 횟수 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Pressure", meta = (ClampMin = "1", ClampMax = "8", EditCondition = "PressureSolverMode == EFluidPressureSolverMode::Multigrid"))
+	int32 MultigridSmoothIterations = 2;
+	
+	/** Red-Black SOR: over-relaxation 계수 (1.0 = Gauss-Seidel) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Pressure", meta = (ClampMin = "1.0", ClampMax = "1.99", EditCondition = "PressureSolverMode == EFluidPressureSolverMode::RedBlackSOR"))
+	float PressureSOROmega = 1.7f;
+	
+	/** 이전 프레임 Pressure에서 풀이 시작 + residual에 따라 반복 횟수 조절 (PressureIterations / MultigridVCycles가 최대값) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Pressure")
+	bool bPressureWarmStart = false;
+	
+	/** 상대 residual(max|r| / max|div|)이 이 값보다 작으면 반복 횟수를 줄임 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Pressure", meta = (ClampMin = "0.0", EditCondition = "bPressureWarmStart"))
+	float PressureResidualTolerance = 0.01f;
+	
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Pressure", meta = (ClampMin = "1", EditCondition = "bPressureWarmStart"))
+	int32 MinPressureIterations = 2;
+	
 	/** Interaction Params */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Fluid|Interaction")
 	bool bEnableActorInteraction = true;
@@ -222,12 +613,13 @@ private:
 	
 	void AddInteractionActor(AActor* Actor, UPrimitiveComponent* Comp);
 	void RemoveInteractionActor(AActor* Actor, UPrimitiveComponent* Comp); 
-	bool WorldLocationToSimulationUV(const FVector& WorldLocation, const FVector& BoundsOrigin, const FVector& BoundsExtents, FVector2f& OutUV);
 	
-	TArray<FFluidInteractionForceSource> BuildInteractionForceSources(float DeltaTime);
+	/** Bounds만 캡처하고 Source 계산은 background task로 (Interaction이 꺼져 있거나 actor가 없으면 nullptr) */
+	TSharedPtr<FFluidInteractionSourceSlot, ESPMode::ThreadSafe> KickInteractionSourceBuild(float DeltaTime);
 	
 	TWeakObjectPtr<UPrimitiveComponent> InteractionBoundsComponent;
-	TArray<FTrackedFluidInteractionActor>  ActiveInteractionActors;
+	/** Overlap 이벤트로만 갱신 (SoA) */
+	TSharedPtr<FFluidInteractionTracker> InteractionTracker;
 	
 	/**Directional Light 관련 함수들 */
 	bool TryResolveDirectionalLight(class ADirectionalLight*& OutLightActor) const;
@@ -237,12 +629,15 @@ private:
 	bool ResolveSimulationBounds(FVector& OutOrigin, FVector& OutExtent) const;
 	FFluidFogRenderState BuildFogRenderStateSnapShot() const;
 	
+	/** Simulation에 대한 인자들을 FFluidSimulationParams 로 묶기 */
+	FFluidSimulationParams BuildSimulationParamsSnapShot(float DeltaTime) const;
+	
 	/** Curve Data를 Array<float> 데이터로 변환 */
 	TArray<float> BuildHeightCurveSamples() const;
 	/** GPU에 변환된 Curve Data Load */
-	void PushHeightCurveSamplesToFogExtension();
+	void PushHeightCurveSamplesToFogProxy();
 	/** Release Height Curve Data */
-	void ReleaseHeightCurveFromFogExtension();
+	void ReleaseHeightCurveFromFogProxy();
 	
 	/** Curve Data dirty flag */
 	bool bWasUsingCurveAttenuation = false;
@@ -252,28 +647,41 @@ private:
 	/** Resources */
 	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources;
 	
-	TSharedPtr<FFogSceneViewExtension, ESPMode::ThreadSafe> FogExtension;
+	FFluidSimulationPrecision GetSimulationPrecision() const;
+	
+	/** CPU Simulation (NullRHI / bForceCPUSimulation) */
+	bool ShouldUseCPUSimulation() const;
+	int32 GetSimulationResolution() const;
+	void InitCPUSimulation();
+	void TickCPUSimulation(float DeltaTime);
+	
+	TSharedPtr<FFluidSimulationCPUWorker, ESPMode::ThreadSafe> CPUSimulation;
+	TSharedPtr<FFluidDensitySnapshot, ESPMode::ThreadSafe> DensitySnapshot;
+	/** 이전 스텝이 끝나지 않아 밀린 시간 */
+	float CPUSimulationPendingDeltaTime = 0.0f;
+	
+	/** Render Thread의 Fog 상태 (UFluidFogSubsystem에 등록) */
+	TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe> FogRenderProxy;
+	/** Fixed timestep: 아직 step으로 소비하지 않은 시간 (< 고정 step) */
 	float AccumulatedTime = 0.f; 
+	/** 마지막 Interaction Source 계산 이후 시간 (step이 없는 프레임의 이동도 다음 step에 포함) */
+	float InteractionElapsedTime = 0.0f;
+	
+	/** 고정 step 간격 (SimulationRate, LOD tick 간격 이상) */
+	float GetFixedStepDeltaTime(float MinStepInterval) const;
+	
+	/** 현재 GPU Simulation 해상도 (LOD 적용, 0 = SimResolution) */
+	int32 ActiveSimResolution = 0;
 	
-	static void ExecuteSimulationRDG(
-	FRHICommandListImmediate& RHICmdList,
+	friend class UFluidFogSubsystem;
+	
+	/** 한 프레임의 NumSubsteps번 step + GPU timer를 GraphBuilder(Frame graph)에 기록 */
+	static void AddSimulationFramePasses(
+	FRDGBuilder& GraphBuilder,
 	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources,
-	float DeltaTime,
+	const FFluidSimulationParams& SimParams,
+	int32 NumSubsteps,
 	 int32 InVelIndex, int32 InDenIndex, int32 InPresIndex,
-	 // 시뮬레이션 파라미터들
-	 float InDissipation,  
-	 float InVorticityStrength,
-	 float InVisc,
-	 int32 InPressureIterations,
-	 // Fog Generation Use Noise
-	 bool bInEnableDensityMaintenance,
-	FTextureRHIRef InBaseDensityNoiseTexture,
-	float InBaseDensityTarget,
-	float InBaseDensityRecoverySpeed,
-	float InBaseDensityDeadbandRatio,
-	float InBaseDensityNoiseRepeat,
-	// Interaction Force
-	const TArray<FFluidInteractionForceSource>& InInteractionForceSources,
 	 // 반환용
 	 int32& OutVelIndex, int32& OutDenIndex, int32& OutPresIndex
 	);
@@ -281,24 +689,69 @@ private:
 	static void AddSimulationPasses(
 	FRDGBuilder& GraphBuilder,
 	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources,
-	float DeltaTime,
+	const FFluidSimulationParams& SimParams,
+	// 프레임마다 한 번 만든 Interaction force bin (substep 공유)
+	const FluidSimulationComponent::FInteractionForceBinBuffers& ForceBins,
 	 int32 InVelIndex, int32 InDenIndex, int32 InPresIndex,
-	 // 시뮬레이션 파라미터들
-	 float InDissipation,  
-	 float InVorticityStrength,
-	 float InVisc,
-	 int32 InPressureIterations,
-	 // Fog Generation Use Noise
-	 bool bInEnableDensityMaintenance,
-	FTextureRHIRef InBaseDensityNoiseTexture,
-	float InBaseDensityTarget,
-	float InBaseDensityRecoverySpeed,
-	float InBaseDensityDeadbandRatio,
-	float InBaseDensityNoiseRepeat,
-	// Interaction Force
-	const TArray<FFluidInteractionForceSource>& InInteractionForceSources,
 	 // 반환용
 	 int32& OutVelIndex, int32& OutDenIndex, int32& OutPresIndex
 	 );
 	
-};
+	/**
+	 * 활성 tile 분류 + 목록 생성, 비활성화된 tile을 0으로 정리
+	 * 반환된 목록/Indirect args로 per-cell pass를 dispatch
+	 */
+	static void AddActiveTilePasses(
+	FRDGBuilder& GraphBuilder,
+	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources,
+	const FFluidSimulationParams& SimParams,
+	FRDGTextureRef Velocity[2],
+	FRDGTextureRef Density[2],
+	FRDGTextureRef Pressure[2],
+	FRDGTextureRef Divergence,
+	FRDGTextureRef TempVelocity,
+	int32 InVelIndex, int32 InDenIndex,
+	FRDGBufferSRVRef ForceTileSourceOffsets,
+	// 반환용
+	FRDGBufferSRVRef& OutActiveTileList,
+	FRDGBufferRef& OutActiveTileArgs
+	);
+	
+	/** Residual 최대값을 GPU에서 구해 비동기 readback 요청 (warm start 반복 횟수 조절용) */
+	static void AddPressureResidualReadbackPass(
+	FRDGBuilder& GraphBuilder,
+	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources,
+	FRDGTextureRef Pressure,
+	FRDGTextureRef Divergence,
+	int32 Resolution
+	);
+	
+	/** Density를 축소해 비동기 readback 요청 (FFluidResources::PollDensityReadback에서 수신) */
+	static void AddDensityReadbackPass(
+	FRDGBuilder& GraphBuilder,
+	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources,
+	const FFluidSimulationParams& SimParams,
+	FRDGTextureRef Density
+	);
+	
+	/** Density 최대값 Mip 생성 (FluidResources->DensityMaxMipPooledRT), DensityHistory가 있으면 두 Density의 최대값 (보간 결과를 덮도록) */
+	static void AddDensityMaxMipPasses(
+	FRDGBuilder& GraphBuilder,
+	TSharedPtr<FFluidResources, ESPMode::ThreadSafe> FluidResources,
+	const FFluidSimulationParams& SimParams,
+	FRDGTextureRef Density,
+	FRDGTextureRef DensityHistory = nullptr
+	);
+	
+	/** Multigrid V-Cycle로 Pressure Poisson 방정식 풀이 (결과는 Pressure[CurPresIdx]) */
+	static void AddPressureMultigridPasses(
+	FRDGBuilder& GraphBuilder,
+	FRDGTextureRef Pressure[2],
+	int32& CurPresIdx,
+	FRDGTextureRef Divergence,
+	int32 Resolution,
+	int32 NumVCycles,
+	int32 NumSmoothIterations
+	);
+	
+};
\ No newline at end of file
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FogShadowVolumeCPU.h"
+
+/**
+ * FluidDensityMaxMip.usf / FogCommon.ush SkipEmptyDensity의 CPU 구현
+ * Mip 0 Cell = Cell UV 범위를 bilinear로 sampling할 때 읽힐 수 있는 texel의 최대 Raw Density, 상위 Mip은 2x2 최대값
+ */
+class VOLUMETRICFOG_API FFogDensityMaxMipCPU
+{
+public:
+	/** UFluidSimulationComponent::AddDensityMaxMipPasses와 같은 Mip 0 크기 (2의 거듭제곱) */
+	static int32 ComputeBaseSize(int32 Resolution, int32 CellSize);
+
+	void Build(const FFogDensityFieldCPU& Field, int32 CellSize);
+
+	/** FogCommon.ush IsMaxDensityEmpty */
+	static bool IsMaxDensityEmpty(const FFluidFogRenderState& State, float MaxRawDensity);
+
+	/** FogCommon.ush SkipEmptyDensity (OutNumLoads: 이번 호출의 Mip 조회 수) */
+	float SkipEmptyDensity(const FFluidFogRenderState& State, const FVector3f& RayOrigin, const FVector3f& RayDir, float T,
+		int32* OutNumLoads = nullptr) const;
+
+	int32 GetBaseSize() const { return BaseSize; }
+	int32 GetNumLevels() const { return Levels.Num(); }
+	float GetMaxDensity(int32 Level, int32 X, int32 Y) const;
+
+private:
+	int32 BaseSize = 0;
+
+	/** Levels[Level][Y * Size + X], Size = BaseSize >> Level */
+	TArray<TArray<float>> Levels;
+};
@@ -8,72 +8,281 @@
 #include "ScreenPass.h"
 #include "HeightCurveLUTResource.h"
 
+class FViewInfo;
+
+// Density sampling / Self Shadow 공용 파라미터 (FogCommon.ush)
+BEGIN_SHADER_PARAMETER_STRUCT(FFogDensityParameters, )
+	SHADER_PARAMETER_RDG_TEXTURE(Texture2D, HeightCurveTexture)
+	SHADER_PARAMETER_SAMPLER(SamplerState, HeightCurveSampler)
+	
+	SHADER_PARAMETER_RDG_TEXTURE(Texture2D, DensityTexture)
+	SHADER_PARAMETER_SAMPLER(SamplerState, BilinearSampler)
+	
+	// Interpolated timestep (이전 step Density와 lerp, Alpha = 1이면 DensityTexture만)
+	SHADER_PARAMETER_RDG_TEXTURE(Texture2D, DensityHistoryTexture)
+	SHADER_PARAMETER(float, DensityInterpolationAlpha)
+
+	SHADER_PARAMETER(float, FogBaseHeight)
+	SHADER_PARAMETER(float, FogMaxHeight)
+
+	//Height Attenuation Mode
+	SHADER_PARAMETER(int32, HeightAttenuationMode)
+	// Legacy
+	SHADER_PARAMETER(float, HeightFalloff)
+
+	//Adaptive
+	SHADER_PARAMETER(float, HeightFadeStartRatio)
+	SHADER_PARAMETER(float, HeightFadeStrength)
+
+	SHADER_PARAMETER(float, FogDensityMultiplier)
+	//SHADER_PARAMETER(float, Absorption)
+	SHADER_PARAMETER(float, AbsorptionScale)
+	SHADER_PARAMETER(float, ScatteringScale)
+
+	SHADER_PARAMETER(FVector3f, SimulationCenter)
+	SHADER_PARAMETER(FVector3f, SimulationExtents)
+		
+	//Debug Parameter 
+	SHADER_PARAMETER(int32, FogDebugMode)
+		
+	//Self Shadow  
+	SHADER_PARAMETER(FVector3f, SelfShadowLightDirection) 
+	SHADER_PARAMETER(float, SelfShadowDensityScale)
+	SHADER_PARAMETER(int32, SelfShadowStepCount)
+	SHADER_PARAMETER(float, SelfShadowMaxDistance)
+	
+	// Empty Space Skipping (Density 최대값 Mip, DensityMaxMipLevels = 0이면 사용 안 함)
+	SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, DensityMaxMipTexture)
+	SHADER_PARAMETER(int32, DensityMaxMipLevels)
+	SHADER_PARAMETER(int32, DensityMaxMipBaseSize)
+END_SHADER_PARAMETER_STRUCT()
+
+// Lighting 공용 파라미터 (FogCommon.ush)
+BEGIN_SHADER_PARAMETER_STRUCT(FFogLightingParameters, )
+	SHADER_PARAMETER(FVector3f, FogColor)
+	
+	//Self Shadow  
+	SHADER_PARAMETER(float, SelfShadowLightIntensity)
+	
+	// Shadow Volume (bUseShadowVolume == 0이면 sample마다 ray march)
+	SHADER_PARAMETER_RDG_TEXTURE(Texture3D, ShadowVolumeTexture)
+	SHADER_PARAMETER_SAMPLER(SamplerState, ShadowVolumeSampler)
+	SHADER_PARAMETER(int32, bUseShadowVolume)
+	
+	//Phase Function
+	SHADER_PARAMETER(float, GOfHG)
+END_SHADER_PARAMETER_STRUCT()
+
+// Scene Depth, Camera 공용 파라미터 (FogView.ush)
+// SceneColor는 읽지 않고 Blend로 합성 (SceneColor = SceneColor * Transmittance + InScattering)
+BEGIN_SHADER_PARAMETER_STRUCT(FFogViewParameters, )
+	SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SceneDepthTexture)
+	SHADER_PARAMETER_SAMPLER(SamplerState, SceneDepthSampler)
+ 
+	SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, SceneDepthViewport)
+	SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, OutputViewport)
+
+	SHADER_PARAMETER(FMatrix44f, InvViewProjectionMatrix)
+	SHADER_PARAMETER(FVector3f, CameraPosition)
+END_SHADER_PARAMETER_STRUCT()
+
+// FogCommon.ush Permutation (정의하지 않은 Shader는 FogDebugMode / HeightAttenuationMode로 runtime 분기)
+class FFogDebugModeDim : SHADER_PERMUTATION_INT("FOG_DEBUG_MODE", 3);
+class FFogHeightModeDim : SHADER_PERMUTATION_INT("FOG_HEIGHT_MODE", 3);
+/** false: Light Transmittance = 1 (SelfShadowDensityScale = 0과 같음) */
+class FFogSelfShadowDim : SHADER_PERMUTATION_BOOL("FOG_SELF_SHADOW");
+/** false: 등방성 Phase (GOfHG = 0과 같음) */
+class FFogPhaseFunctionDim : SHADER_PERMUTATION_BOOL("FOG_PHASE_FUNCTION");
+
 // Ray Marching PS
 class FFogRayMarchingPS : public FGlobalShader
 {
 public:
 	DECLARE_GLOBAL_SHADER(FFogRayMarchingPS);
 	SHADER_USE_PARAMETER_STRUCT(FFogRayMarchingPS, FGlobalShader);
+	
+	/** 축소 해상도 / Temporal: SceneColor 대신 중간 Target에 Fog(InScattering, Transmittance) + 선형 depth 출력 */
+	class FFogLowResDim : SHADER_PERMUTATION_BOOL("FOG_LOW_RES");
+	using FPermutationDomain = TShaderPermutationDomain<FFogLowResDim, FFogDebugModeDim, FFogHeightModeDim, FFogSelfShadowDim, FFogPhaseFunctionDim>;
+	
+	/** 결과가 같은 조합은 하나로 (2D: Height / Self Shadow 안 씀, Debug Self Shadow: Self Shadow 필수 / Phase 안 씀) */
+	static FPermutationDomain RemapPermutation(FPermutationDomain PermutationVector)
+	{
+		const int32 DebugMode = PermutationVector.Get<FFogDebugModeDim>();
+		if (DebugMode == 0)
+		{
+			PermutationVector.Set<FFogHeightModeDim>(0);
+			PermutationVector.Set<FFogSelfShadowDim>(false);
+		}
+		else if (DebugMode == 2)
+		{
+			PermutationVector.Set<FFogSelfShadowDim>(true);
+			PermutationVector.Set<FFogPhaseFunctionDim>(false);
+		}
+		return PermutationVector;
+	}
 
 	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
-		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SceneColorTexture)
-		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SceneDepthTexture)
-		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, HeightCurveTexture)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFogDensityParameters, Density)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFogLightingParameters, Lighting)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFogViewParameters, View)
+	
+        SHADER_PARAMETER(int, NumSteps)
+        SHADER_PARAMETER(float, MaxRayDistance)
+	
+		// Temporal Jitter
+		SHADER_PARAMETER(int32, bTemporalJitter)
+		SHADER_PARAMETER(float, TemporalJitterOffset)
+			
+        RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+	
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		const FPermutationDomain PermutationVector(Parameters.PermutationId);
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5)
+			&& RemapPermutation(PermutationVector) == PermutationVector;
+	}
+};
+
+// 축소 해상도 Ray March 결과를 Scene Depth 기준 Joint Bilateral Upsample 후 합성
+class FFogUpsamplePS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFogUpsamplePS);
+	SHADER_USE_PARAMETER_STRUCT(FFogUpsamplePS, FGlobalShader);
 
-		SHADER_PARAMETER_SAMPLER(SamplerState, SceneColorSampler)
-		SHADER_PARAMETER_SAMPLER(SamplerState, SceneDepthSampler)
-		SHADER_PARAMETER_SAMPLER(SamplerState, HeightCurveSampler)
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFogViewParameters, View)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, FogLowResTexture)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, FogLowResDepthTexture)
+		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, LowResViewport)
+		SHADER_PARAMETER(float, UpsampleDepthTolerance)
+		SHADER_PARAMETER(float, MaxRayDistance)
 	
-		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, DensityTexture)
-		SHADER_PARAMETER_SAMPLER(SamplerState, BilinearSampler)
-	 
-		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, SceneColorViewport)
-		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, SceneDepthViewport)
-		SHADER_PARAMETER_STRUCT(FScreenPassTextureViewportParameters, OutputViewport)
+        RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
 
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+// Ray March Fog Temporal 누적: Depth reprojection + 이웃 clamp (FogTemporal.usf)
+class FFogTemporalCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFogTemporalCS);
+	SHADER_USE_PARAMETER_STRUCT(FFogTemporalCS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, FogTexture)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, FogDepthTexture)
+	
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, HistoryFogTexture)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, HistoryDepthTexture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, HistorySampler)
+		SHADER_PARAMETER_SAMPLER(SamplerState, HistoryDepthSampler)
+	
+		SHADER_PARAMETER(FIntPoint, FogSize)
+		SHADER_PARAMETER(float, MaxRayDistance)
+	
 		SHADER_PARAMETER(FMatrix44f, InvViewProjectionMatrix)
 		SHADER_PARAMETER(FVector3f, CameraPosition)
+		SHADER_PARAMETER(FMatrix44f, PrevViewProjectionMatrix)
+		SHADER_PARAMETER(FVector3f, PrevCameraPosition)
+	
+		SHADER_PARAMETER(float, HistoryWeight)
+		SHADER_PARAMETER(int32, bHistoryValid)
+	
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, RWFogOutput)
+	END_SHADER_PARAMETER_STRUCT()
+	
+	static constexpr int32 ThreadGroupSize = 8;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+// Froxel 렌더러 (FogFroxel.usf)
+// Inject: Froxel 중심 Scattering / Extinction + 이전 프레임 reprojection 누적
+class FFogFroxelInjectCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFogFroxelInjectCS);
+	SHADER_USE_PARAMETER_STRUCT(FFogFroxelInjectCS, FGlobalShader);
 
-		SHADER_PARAMETER(float, FogBaseHeight)
-		SHADER_PARAMETER(float, FogMaxHeight)
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFogDensityParameters, Density)
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFogLightingParameters, Lighting)
+	
+		SHADER_PARAMETER(FMatrix44f, InvViewProjectionMatrix)
+		SHADER_PARAMETER(FVector3f, CameraPosition)
+		SHADER_PARAMETER(FIntVector, FroxelGridSize)
+		SHADER_PARAMETER(float, MaxRayDistance)
+	
+		// Temporal Reprojection
+		SHADER_PARAMETER(FMatrix44f, PrevViewProjectionMatrix)
+		SHADER_PARAMETER(FVector3f, PrevCameraPosition)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture3D, HistoryTexture)
+		SHADER_PARAMETER_SAMPLER(SamplerState, HistorySampler)
+		SHADER_PARAMETER(float, HistoryWeight)
+		SHADER_PARAMETER(int32, bHistoryValid)
+		SHADER_PARAMETER(float, FroxelJitter)
+	
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture3D<float4>, RWFroxelScattering)
+	END_SHADER_PARAMETER_STRUCT()
+	
+	static constexpr int32 ThreadGroupSize = 4;
 
-		//Height Attenuation Mode
-		SHADER_PARAMETER(int32, HeightAttenuationMode)
-		// Legacy
-		SHADER_PARAMETER(float, HeightFalloff)
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
 
-		//Adaptive
-		SHADER_PARAMETER(float, HeightFadeStartRatio)
-		SHADER_PARAMETER(float, HeightFadeStrength)
+// Integrate: Froxel 열마다 front-to-back 적분 (InScattering, Transmittance)
+class FFogFroxelIntegrateCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFogFroxelIntegrateCS);
+	SHADER_USE_PARAMETER_STRUCT(FFogFroxelIntegrateCS, FGlobalShader);
 
-		SHADER_PARAMETER(float, FogDensityMultiplier)
-        //SHADER_PARAMETER(float, Absorption)
-        SHADER_PARAMETER(float, AbsorptionScale)
-        SHADER_PARAMETER(float, ScatteringScale)
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER(FIntVector, FroxelGridSize)
+		SHADER_PARAMETER(float, MaxRayDistance)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture3D, FroxelScattering)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture3D<float4>, RWIntegratedFroxel)
+	END_SHADER_PARAMETER_STRUCT()
+	
+	static constexpr int32 ThreadGroupSize = 8;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+};
+
+// Apply: Scene Depth로 적분 결과를 한 번 lookup
+class FFogFroxelApplyPS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFogFroxelApplyPS);
+	SHADER_USE_PARAMETER_STRUCT(FFogFroxelApplyPS, FGlobalShader);
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFogViewParameters, View)
+		SHADER_PARAMETER(FIntVector, FroxelGridSize)
+		SHADER_PARAMETER(float, MaxRayDistance)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture3D, IntegratedFroxel)
+		SHADER_PARAMETER_SAMPLER(SamplerState, IntegratedFroxelSampler)
 	
-        SHADER_PARAMETER(FVector3f, FogColor)
-        SHADER_PARAMETER(int, NumSteps)
-        SHADER_PARAMETER(float, MaxRayDistance)
- 
-        SHADER_PARAMETER(FVector3f, SimulationCenter)
-        SHADER_PARAMETER(FVector3f, SimulationExtents)
-		
-		//Debug Parameter 
-		SHADER_PARAMETER(int32, FogDebugMode)
-		
-		//Self Shadow  
-		SHADER_PARAMETER(FVector3f, SelfShadowLightDirection) 
-		SHADER_PARAMETER(float, SelfShadowLightIntensity)
-		SHADER_PARAMETER(float, SelfShadowDensityScale)
-		SHADER_PARAMETER(int32, SelfShadowStepCount)
-		SHADER_PARAMETER(float, SelfShadowMaxDistance)
-	
-		//Phase Function
-		SHADER_PARAMETER(float, GOfHG)
-			
         RENDER_TARGET_BINDING_SLOTS()
 	END_SHADER_PARAMETER_STRUCT()
-	
+
 	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
 	{
 		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
@@ -81,6 +290,38 @@ public:
 };
 
  
+// Self Shadow Volume bake CS
+// SelfShadowLightDirection 방향 Optical Depth를 Simulation Box를 덮는 3D texture에 저장
+class FFogShadowVolumeCS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FFogShadowVolumeCS);
+	SHADER_USE_PARAMETER_STRUCT(FFogShadowVolumeCS, FGlobalShader);
+	
+	using FPermutationDomain = TShaderPermutationDomain<FFogHeightModeDim>;
+
+	BEGIN_SHADER_PARAMETER_STRUCT(FParameters, )
+		SHADER_PARAMETER_STRUCT_INCLUDE(FFogDensityParameters, Density)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture3D<float>, RWShadowVolume)
+		SHADER_PARAMETER(FIntVector, ShadowVolumeSize)
+	END_SHADER_PARAMETER_STRUCT()
+	
+	static constexpr int32 ThreadGroupSize = 4;
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::SM5);
+	}
+	
+	static void ModifyCompilationEnvironment(const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		
+		// 2D Simulation(FogDebugMode = 0)에서는 bake하지 않음
+		OutEnvironment.SetDefine(TEXT("FOG_DEBUG_MODE"), 1);
+	}
+};
+
 // 테스트용 Full Screen PS
 class FFogFullscreenPS: public FGlobalShader
 {
@@ -138,42 +379,162 @@ struct FFluidFogRenderState
 	int32 SelfShadowStepCount = 6;
 	float SelfShadowMaxDistance = 2000.0f;
 	
+	// Shadow Volume (false면 sample마다 Light 방향 ray march)
+	bool bUseShadowVolume = true;
+	FIntVector ShadowVolumeResolution = FIntVector(64, 64, 32);
+	
 	// Phase Function
 	float GOfHG = 0.0f;
 	
-	FTextureRHIRef DensityTexture; 
+	// Ray March 해상도 (1 = Full, 2 = Half, 4 = Quarter)
+	int32 RayMarchDownsampleFactor = 1;
+	float UpsampleDepthTolerance = 0.05f;
+	
+	// Temporal Ray March (jitter + History 누적)
+	bool bTemporalRayMarch = false;
+	float TemporalHistoryWeight = 0.9f;
+	
+	// Render Mode (0 = 픽셀당 Ray March, 1 = Froxel)
+	int32 FogRenderMode = 0;
+	FIntVector FroxelGridSize = FIntVector(160, 90, 64);
+	float FroxelHistoryWeight = 0.9f;
+	
+	// Empty Space Skipping
+	bool bEmptySpaceSkipping = true;
+	
+	/** Simulation의 PooledRT 그대로 (같은 frame graph에서 Simulation pass와 같은 RDG texture로 등록됨) */
+	TRefCountPtr<IPooledRenderTarget> DensityPooledRT;
+	/** Density 최대값 Mip (Simulation에서 생성, 없으면 Skipping 안 함) */
+	TRefCountPtr<IPooledRenderTarget> DensityMaxMipPooledRT;
+	/** Interpolated timestep: 마지막 step 직전 Density (없으면 보간 안 함) */
+	TRefCountPtr<IPooledRenderTarget> DensityHistoryPooledRT;
+	/** DensityHistoryPooledRT → DensityPooledRT 보간 비율 (1 = DensityPooledRT) */
+	float DensityInterpolationAlpha = 1.0f;
 	FTextureRHIRef ShapeNoiseTexture;
 	
 };
-// SceneViewExtension
-class FFogSceneViewExtension : public FSceneViewExtensionBase
+
+class FFogVolumeRenderProxy;
+
+/** Simulation pass 기록 + Render State 갱신 (UFluidSimulationComponent가 만들고 Frame graph 기록 시점에 실행) */
+using FFogSimulationUpdate = TUniqueFunction<void(FRDGBuilder& GraphBuilder, FFogVolumeRenderProxy& Proxy)>;
+// View별 Froxel History (FSceneView::GetViewKey)
+struct FFogFroxelHistory
 {
-public:
-	FFogSceneViewExtension(const FAutoRegister& AutoRegister);
-	virtual ~FFogSceneViewExtension();
+	TRefCountPtr<IPooledRenderTarget> Scattering;
+	FMatrix44f ViewProjectionMatrix = FMatrix44f::Identity;
+	FVector3f CameraPosition = FVector3f::ZeroVector;
+	uint32 FrameIndex = 0;
+};
 
-	// 필수 오버라이드
-	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
-	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
-	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override {}
-	
+// View별 Ray March Temporal History (축소 해상도 Fog + 선형 depth)
+struct FFogRayMarchHistory
+{
+	TRefCountPtr<IPooledRenderTarget> Fog;
+	TRefCountPtr<IPooledRenderTarget> Depth;
+	FMatrix44f ViewProjectionMatrix = FMatrix44f::Identity;
+	FVector3f CameraPosition = FVector3f::ZeroVector;
+	uint32 FrameIndex = 0;
+};
+
+/**
+ * Fog Volume 하나의 Render Thread 상태 (UFluidSimulationComponent 하나당 하나)
+ * Pass 등록은 공유 FFogSceneViewExtension이 View마다 정렬해서 호출
+ */
+class FFogVolumeRenderProxy
+{
+public:
 	/** Render Thread Helper Function */
 	
-	/** density texture가 바뀌었으면, RDG 등록용 및 PooledRT 갱신 */
+	/** Render State 교체 (Shadow Volume은 다시 bake) */
 	void ApplyRenderState_RenderThread(const FFluidFogRenderState& InState);
 	
+	/**
+	 * Simulation update를 다음 View Family의 frame graph에 기록하도록 대기 (FFogSceneViewExtension::PreRenderViewFamily_RenderThread)
+	 * Extension에 등록되지 않았거나 이전 update가 아직 대기 중이면(렌더된 View Family가 없었음) 단독 graph로 실행
+	 */
+	void QueueSimulationUpdate_RenderThread(FRHICommandListImmediate& RHICmdList, FFogSimulationUpdate&& Update);
+	
+	/** 대기 중인 Simulation update를 GraphBuilder에 기록 */
+	void AddPendingSimulationPasses_RenderThread(FRDGBuilder& GraphBuilder);
+	
+	/** Extension 등록 여부 (해제되면 대기 중인 update는 버림) */
+	void SetInFrameGraph_RenderThread(bool bInFrameGraph);
+	
 	void UpdateHeightCurveLUT_RenderThread(FRHICommandListImmediate& RHICmdList, TConstArrayView<float> Samples);
 	void ReleaseHeightCurveLUT_RenderThread();
+	
+	/** 활성화 + Density가 준비됨 */
+	bool IsRenderable() const { return RenderState.bEnable && RenderState.DensityPooledRT.IsValid(); }
+	
+	FBox GetWorldBounds() const { return FBox::BuildAABB(FVector(RenderState.SimulationCenter), FVector(RenderState.SimulationExtents)); }
+	
+	/** SceneColor의 FogRect(= Simulation Box 화면 사각형)에 Fog Blend 합성 */
+	void Render_RenderThread(FPostOpaqueRenderParameters& InParameters, const FIntRect& FogRect);
 
 private:
-	void RenderFog_RenderThread(FPostOpaqueRenderParameters& InParameters);
+	/** Shadow Volume이 이번 Simulation tick에 아직 bake되지 않았으면 bake, 아니면 캐싱된 volume 등록 */
+	FRDGTextureRef AddShadowVolumePass(FRDGBuilder& GraphBuilder, ERHIFeatureLevel::Type FeatureLevel, const FFogDensityParameters& DensityParameters);
+	
+	/**
+	 * 축소 해상도 Ray March → (Temporal 누적) → Bilateral Upsample, Temporal이면 DownsampleFactor = 1도 사용
+	 * Upsample은 Output(SceneColor)의 FogRect에만 Blend 합성
+	 */
+	void AddLowResRayMarchPasses(FRDGBuilder& GraphBuilder, const FViewInfo& View, const FFogDensityParameters& DensityParameters,
+		const FFogLightingParameters& LightingParameters, const FFogViewParameters& ViewParameters, const FScreenPassRenderTarget& Output,
+		const FIntRect& FogRect, int32 DownsampleFactor);
+	
+	/** Froxel 렌더러: Inject → Integrate → Apply (Output(SceneColor)의 FogRect에만 Blend 합성) */
+	void AddFroxelFogPasses(FRDGBuilder& GraphBuilder, const FViewInfo& View, const FFogDensityParameters& DensityParameters,
+		const FFogLightingParameters& LightingParameters, const FFogViewParameters& ViewParameters, const FScreenPassRenderTarget& Output,
+		const FIntRect& FogRect);
 
+	/** 대기 중인 Simulation update를 단독 graph로 실행 */
+	void FlushPendingSimulation_RenderThread(FRHICommandListImmediate& RHICmdList);
+	
 	FFluidFogRenderState RenderState;
-	TRefCountPtr<IPooledRenderTarget> DensityPooledRT;  
 	
-	FDelegateHandle PostOpaqueDelegateHandle; 
+	FFogSimulationUpdate PendingSimulationUpdate;
+	bool bInFrameGraph = false;
+	
+	// Shadow Volume (ApplyRenderState_RenderThread마다 dirty, 첫 View에서 bake)
+	TRefCountPtr<IPooledRenderTarget> ShadowVolumePooledRT;
+	bool bShadowVolumeDirty = true;
+	
+	TMap<uint32, FFogFroxelHistory> FroxelHistories;
+	TMap<uint32, FFogRayMarchHistory> RayMarchHistories;
 	
 	// Height Atteunation Resource 
 	TUniquePtr<FHeightCurveLUTResource> HeightCurveResource;
 	TRefCountPtr<IPooledRenderTarget> HeightCurvePooledRT;
 };
+
+// SceneViewExtension (World당 하나, UFluidFogSubsystem 소유)
+class FFogSceneViewExtension : public FSceneViewExtensionBase
+{
+public:
+	FFogSceneViewExtension(const FAutoRegister& AutoRegister, FSceneInterface* InScene);
+	virtual ~FFogSceneViewExtension();
+
+	// 필수 오버라이드
+	virtual void SetupViewFamily(FSceneViewFamily& InViewFamily) override {}
+	virtual void SetupView(FSceneViewFamily& InViewFamily, FSceneView& InView) override {}
+	virtual void BeginRenderViewFamily(FSceneViewFamily& InViewFamily) override {}
+	
+	/** 대기 중인 Simulation step을 이 Scene의 frame graph에 기록 (Fog 렌더와 같은 graph, RDG가 transient alias / culling) */
+	virtual void PreRenderViewFamily_RenderThread(FRDGBuilder& GraphBuilder, FSceneViewFamily& InViewFamily) override;
+	
+	void AddVolume_RenderThread(const TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>& Volume);
+	void RemoveVolume_RenderThread(const TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>& Volume);
+
+private:
+	/** 화면에 보이는 Volume만 먼 것부터 합성 (PostOpaque 델리게이트 하나) */
+	void RenderFog_RenderThread(FPostOpaqueRenderParameters& InParameters);
+	
+	/** PostOpaque 델리게이트는 모든 Scene에서 호출되므로 이 Scene의 View만 렌더 */
+	FSceneInterface* Scene = nullptr;
+	
+	TArray<TSharedPtr<FFogVolumeRenderProxy, ESPMode::ThreadSafe>> Volumes;
+	
+	FDelegateHandle PostOpaqueDelegateHandle; 
+};
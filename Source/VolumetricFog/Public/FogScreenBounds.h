@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Simulation Box를 화면에 투영한 사각형 (Fog 합성 Pass의 Draw Rect / Scissor)
+ * 화면 밖 Box는 Pass 없음, 카메라가 Box 안이면 ViewRect 전체
+ */
+struct VOLUMETRICFOG_API FFogScreenBounds
+{
+	/** ViewRect 안으로 clip된 픽셀 사각형 (비어 있으면 Fog를 그리지 않음) */
+	FIntRect Rect;
+	/** 카메라가 Box 안 (Rect = ViewRect) */
+	bool bCameraInside = false;
+	/** Box 일부가 Near Plane 뒤 (잘린 Box의 꼭짓점으로 계산) */
+	bool bClippedByNearPlane = false;
+
+	bool IsVisible() const { return Rect.Width() > 0 && Rect.Height() > 0; }
+
+	/**
+	 * Box 12개 모서리를 clip space에서 Near Plane(w = NearPlaneW)으로 자른 뒤 남은 꼭짓점들의 화면 사각형
+	 * ViewProjectionMatrix는 UE 규약(view space x = 오른쪽, y = 위, w = 카메라 앞 거리)
+	 */
+	static FFogScreenBounds Compute(const FMatrix& ViewProjectionMatrix, const FVector& ViewOrigin, const FBox& Box,
+		const FIntRect& ViewRect, double NearPlaneW);
+};
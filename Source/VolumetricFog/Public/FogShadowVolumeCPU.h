@@ -0,0 +1,49 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "FogSceneViewExtension.h"
+
+/** FogCommon.ush의 Density sampling 입력 */
+struct FFogDensityFieldCPU
+{
+	/** Resolution x Resolution, row-major (FFluidSimulationCPU::GetDensity) */
+	TConstArrayView<float> Density;
+	int32 Resolution = 0;
+
+	/** Height Curve LUT (비어 있으면 SystemTextures.White처럼 1) */
+	TConstArrayView<float> HeightCurve;
+};
+
+/**
+ * FogShadowVolume.usf / FogCommon.ush의 CPU 구현
+ * Simulation Box를 덮는 volume에 Light 방향 Optical Depth를 bake하고 trilinear로 lookup (PF_R16F 저장까지 재현)
+ *
+ * ComputeLightOpticalDepth가 FogRayMarch.usf의 기존 per-sample ray march 기준값
+ */
+class VOLUMETRICFOG_API FFogShadowVolumeCPU
+{
+public:
+	/** FogCommon.ush ShapeExtrudedDensity (Raw Density에 대해 단조 증가) */
+	static float ShapeExtrudedDensity(float RawDensity);
+
+	/** FogCommon.ush SampleDensity */
+	static float SampleDensity(const FFluidFogRenderState& State, const FFogDensityFieldCPU& Field, const FVector3f& WorldPos);
+
+	/** FogCommon.ush ComputeLightOpticalDepth (SelfShadowStepCount 만큼 ray march) */
+	static float ComputeLightOpticalDepth(const FFluidFogRenderState& State, const FFogDensityFieldCPU& Field, const FVector3f& WorldPos);
+
+	/** Voxel 중심 = BoxMin + (xyz + 0.5) / InSize * BoxSize */
+	void Bake(const FFluidFogRenderState& State, const FFogDensityFieldCPU& Field, const FIntVector& InSize);
+
+	/** FogRayMarch.usf SampleShadowVolumeTransmittance (Bake에 쓴 State와 같은 Box) */
+	float SampleTransmittance(const FFluidFogRenderState& State, const FVector3f& WorldPos) const;
+
+	FIntVector GetSize() const { return Size; }
+	TConstArrayView<float> GetOpticalDepth() const { return OpticalDepth; }
+
+private:
+	FIntVector Size = FIntVector::ZeroValue;
+
+	/** Index = (Z * Size.Y + Y) * Size.X + X */
+	TArray<float> OpticalDepth;
+};